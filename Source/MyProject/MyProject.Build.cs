@@ -17,14 +17,18 @@ public class MyProject : ModuleRules
 			"NavigationSystem",
 			"Niagara",
 			"EnhancedInput",
-			"PhysicsCore"
+			"PhysicsCore",
+			"Chaos"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] 
 		{
 			"Slate",
 			"SlateCore",
-			"UMG"
+			"UMG",
+			"Json",
+			"RenderCore",
+			"RHI"
 		});
 		
 		// Para VR
@@ -1,9 +1,32 @@
 #include "Cultivo.h"
 #include "Kismet/GameplayStatics.h"
 #include "MyProject/VR/GameModes/HarvestHavenGameManager.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmEventBusSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmFrameBudgetSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmSoilMoistureSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Crop Update"), STAT_FarmCropUpdate, STATGROUP_HarvestHaven);
+
+// Contadores "Crops <estado>" de stat HarvestHaven
+static void AdjustCropStateStat(ECultivoState State, int32 Delta)
+{
+	switch (State)
+	{
+	case ECultivoState::Semilla:   FARM_COUNTER_ADD(CropsSeed, Delta); break;
+	case ECultivoState::Creciendo: FARM_COUNTER_ADD(CropsGrowing, Delta); break;
+	case ECultivoState::Maduro:    FARM_COUNTER_ADD(CropsMature, Delta); break;
+	case ECultivoState::Seco:      FARM_COUNTER_ADD(CropsDry, Delta); break;
+	}
+}
 
 ACultivo::ACultivo()
 {
+	FARM_LLM_SCOPE(Crops);
+
 	PrimaryActorTick.bCanEverTick = true;
 
 	// Crear mesh component
@@ -15,6 +38,7 @@ ACultivo::ACultivo()
 	CurrentState = ECultivoState::Semilla;
 	TiempoTranscurrido = 0.0f;
 	TiempoUltimoRiego = 0.0f;
+	TiempoSinHumedad = 0.0f;
 	bNecesitaRiego = false;
 	bFueCosechado = false;
 
@@ -24,6 +48,8 @@ ACultivo::ACultivo()
 
 void ACultivo::BeginPlay()
 {
+	FARM_LLM_SCOPE(Crops);
+
 	Super::BeginPlay();
 
 	// Configurar mesh inicial
@@ -38,17 +64,89 @@ void ACultivo::BeginPlay()
 		ValorCosecha = Info.SellPrice;
 	}
 
+	// Los precalentados esperan en el pool hasta que una parcela los plante
+	if (!UFarmActorPoolSubsystem::IsPooled(this))
+	{
+		ActivateCultivo();
+	}
+}
+
+void ACultivo::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DeactivateCultivo();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ACultivo::OnAcquiredFromPool()
+{
+	ActivateCultivo();
+}
+
+void ACultivo::OnReturnedToPool()
+{
+	DeactivateCultivo();
+
+	// Vuelve a Semilla sin pasar por ChangeState: fuera de juego no hay eventos ni contadores
+	CurrentState = ECultivoState::Semilla;
+	TiempoTranscurrido = 0.0f;
+	TiempoSinHumedad = 0.0f;
+	bNecesitaRiego = false;
+	bFueCosechado = false;
+	UpdateVisualMesh();
+}
+
+void ACultivo::ActivateCultivo()
+{
+	if (bActivo)
+	{
+		return;
+	}
+
+	bActivo = true;
+
 	// Registrar tiempo inicial de riego
 	TiempoUltimoRiego = GetWorld()->GetTimeSeconds();
 
-	UE_LOG(LogTemp, Log, TEXT("Cultivo: %s planted - Growth time: %.1fs"), 
-		*GetName(), TiempoCrecimientoSegundos);
+	AdjustCropStateStat(CurrentState, 1);
+
+	// Con el presupuesto de frame los cultivos no tickean: se actualizan por turnos
+	if (UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this))
+	{
+		SetActorTickEnabled(false);
+		FrameBudget->RegisterRecurring(EFarmWorkSystem::CropUpdate, this, IntervaloActualizacion,
+			[this](float ElapsedTime) { UpdateCultivo(ElapsedTime); });
+	}
+}
+
+void ACultivo::DeactivateCultivo()
+{
+	if (!bActivo)
+	{
+		return;
+	}
+
+	bActivo = false;
+
+	AdjustCropStateStat(CurrentState, -1);
+
+	if (UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this))
+	{
+		FrameBudget->UnregisterRecurring(EFarmWorkSystem::CropUpdate, this);
+	}
 }
 
 void ACultivo::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	UpdateCultivo(DeltaTime);
+}
+
+void ACultivo::UpdateCultivo(float DeltaTime)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmCropUpdate);
+
 	// No actualizar si ya fue cosechado
 	if (bFueCosechado)
 	{
@@ -70,9 +168,13 @@ void ACultivo::StartGrowth()
 {
 	TiempoTranscurrido = 0.0f;
 	TiempoUltimoRiego = GetWorld()->GetTimeSeconds();
+	TiempoSinHumedad = 0.0f;
 	ChangeState(ECultivoState::Semilla);
 	
-	UE_LOG(LogTemp, Log, TEXT("Cultivo: Growth started for %s"), *GetName());
+	// La parcela ya configuró tipo y tiempo de crecimiento antes de llamar aquí
+	FARM_EVENT(CropPlanted, this, static_cast<float>(TipoCultivo), TiempoCrecimientoSegundos);
+	UE_LOG(LogTemp, Log, TEXT("Cultivo: Growth started for %s - Growth time: %.1fs"),
+		*GetName(), TiempoCrecimientoSegundos);
 }
 
 float ACultivo::GetGrowthPercent() const
@@ -130,16 +232,27 @@ void ACultivo::ChangeState(ECultivoState NewState)
 		return;
 	}
 
+	FARM_TRACE_EVENT_SCOPE(Farm_CropStateChange);
+
 	ECultivoState OldState = CurrentState;
 	CurrentState = NewState;
 
+	if (bActivo)
+	{
+		AdjustCropStateStat(OldState, -1);
+		AdjustCropStateStat(NewState, 1);
+		FARM_COUNTER_INC(CropStateChanges);
+	}
+
 	// Actualizar visual
 	UpdateVisualMesh();
 
-	// Broadcast evento
-	OnStateChanged.Broadcast(CurrentState, GetGrowthPercent());
+	// Evento: se entrega al final del frame junto con los demás
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::CropStateChanged, this, INDEX_NONE, static_cast<int32>(CurrentState), GetGrowthPercent()));
 
-	UE_LOG(LogTemp, Log, TEXT("Cultivo: State changed %s -> %s (%.1f%%)"), 
+	// Sin formateo en el game thread: el evento binario basta para diagnosticar
+	FARM_EVENT(CropStateChanged, this, static_cast<float>(NewState), GetGrowthPercent(), static_cast<float>(OldState));
+	UE_LOG(LogHarvestHaven, Verbose, TEXT("Cultivo: State changed %s -> %s (%.1f%%)"), 
 		*UEnum::GetValueAsString(OldState), 
 		*UEnum::GetValueAsString(CurrentState),
 		GetGrowthPercent());
@@ -151,24 +264,33 @@ void ACultivo::ChangeState(ECultivoState NewState)
 
 void ACultivo::Water()
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_Water);
+
 	// No se puede regar si está maduro o seco
 	if (CurrentState == ECultivoState::Maduro)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("Cultivo: Already mature, doesn't need water"));
+		UE_LOG(LogHarvestHaven, VeryVerbose, TEXT("Cultivo: Already mature, doesn't need water"));
 		return;
 	}
 
 	if (CurrentState == ECultivoState::Seco)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Cultivo: Too late, already dry"));
+		UE_LOG(LogHarvestHaven, Verbose, TEXT("Cultivo: Too late, already dry"));
 		return;
 	}
 
+	// Sobre la cuadrícula el agua va a la celda del suelo, que es lo que lee UpdateWaterNeed
+	if (UFarmSoilMoistureSubsystem* Suelo = UFarmSoilMoistureSubsystem::Get(this))
+	{
+		Suelo->AddWater(GetActorLocation(), 0.0f, 1.0f);
+	}
+
 	// Actualizar tiempo de riego
 	TiempoUltimoRiego = GetWorld()->GetTimeSeconds();
+	TiempoSinHumedad = 0.0f;
 	bNecesitaRiego = false;
 
-	UE_LOG(LogTemp, Log, TEXT("Cultivo: Watered successfully"));
+	FARM_EVENT(CropWatered, this, GetGrowthPercent());
 }
 
 float ACultivo::GetTimeSinceLastWater() const
@@ -189,21 +311,58 @@ void ACultivo::UpdateWaterNeed(float DeltaTime)
 		return;
 	}
 
+	// Sobre la cuadrícula de humedad manda el suelo, no el temporizador
+	if (const UFarmSoilMoistureSubsystem* Suelo = UFarmSoilMoistureSubsystem::Get(this))
+	{
+		const FVector Location = GetActorLocation();
+		if (Suelo->Covers(Location))
+		{
+			UpdateWaterNeedFromSoil(Suelo->GetMoisture(Location), DeltaTime);
+			return;
+		}
+	}
+
 	float TimeSinceWater = GetTimeSinceLastWater();
 
 	// Verificar si necesita riego (después de IntervaloRiego segundos)
 	if (!bNecesitaRiego && TimeSinceWater >= IntervaloRiego)
 	{
 		bNecesitaRiego = true;
-		OnNeedsWater.Broadcast();
-		UE_LOG(LogTemp, Warning, TEXT("Cultivo: NEEDS WATER! (%.1fs since last water)"), TimeSinceWater);
+		UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::CropNeedsWater, this));
+		FARM_EVENT(CropNeedsWater, this, TimeSinceWater);
 	}
 
 	// Verificar si se secó (después de TiempoAntesDeSecar segundos sin riego)
 	if (TimeSinceWater >= TiempoAntesDeSecar)
 	{
 		ChangeState(ECultivoState::Seco);
-		UE_LOG(LogTemp, Error, TEXT("Cultivo: DRIED UP! Value reduced to 50%%"));
+		FARM_EVENT(CropDried, this, TimeSinceWater);
+	}
+}
+
+void ACultivo::UpdateWaterNeedFromSoil(float Humedad, float DeltaTime)
+{
+	if (Humedad >= HumedadMinima)
+	{
+		bNecesitaRiego = false;
+		TiempoSinHumedad = 0.0f;
+		return;
+	}
+
+	TiempoSinHumedad += DeltaTime;
+
+	if (!bNecesitaRiego)
+	{
+		bNecesitaRiego = true;
+		UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::CropNeedsWater, this));
+		FARM_EVENT(CropNeedsWater, this, Humedad);
+	}
+
+	// Mismo margen que con el temporizador entre necesitar riego y secarse
+	if (TiempoSinHumedad >= FMath::Max(TiempoAntesDeSecar - IntervaloRiego, 0.0f))
+	{
+		ChangeState(ECultivoState::Seco);
+		FARM_EVENT(CropDried, this, TiempoSinHumedad);
 	}
 }
 
@@ -234,10 +393,10 @@ bool ACultivo::TryHarvest(int32& OutValue)
 	OutValue = GetCurrentHarvestValue();
 	bFueCosechado = true;
 
-	// Broadcast evento
-	OnHarvested.Broadcast();
+	// Evento
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::CropHarvested, this));
 
-	UE_LOG(LogTemp, Log, TEXT("Cultivo: Harvested successfully - Value: %d"), OutValue);
+	FARM_EVENT(CropHarvested, this, static_cast<float>(OutValue), static_cast<float>(CurrentState));
 
 	// El actor se puede destruir después o dejar que la cesta lo maneje
 	return true;
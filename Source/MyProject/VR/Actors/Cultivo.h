@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "MyProject/VR/Gameplay/GameplayTypes.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
 #include "Cultivo.generated.h"
 
 // Estados posibles de un cultivo
@@ -24,12 +25,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCultivoHarvested);
  * Clase base para todos los cultivos del juego.
  * Maneja:
  * - Crecimiento automático con timer
- * - Sistema de riego (cada 60s)
+ * - Sistema de riego: humedad del suelo (UFarmSoilMoistureSubsystem) o, fuera de la cuadrícula, cada 60s
  * - Estados visuales (Semilla -> Creciendo -> Maduro -> Seco)
  * - Cosecha y valor monetario
+ * Las parcelas los sacan de UFarmActorPoolSubsystem y los devuelven al cosechar.
  */
 UCLASS()
-class MYPROJECT_API ACultivo : public AActor
+class MYPROJECT_API ACultivo : public AActor, public IFarmPoolable
 {
 	GENERATED_BODY()
 
@@ -40,6 +42,7 @@ public:
 	// EVENTS
 	// ============================================================
 	
+	// Para Blueprint: los dispara UFarmEventBusSubsystem al final del frame (código nativo: Subscribe)
 	UPROPERTY(BlueprintAssignable, Category = "Cultivo Events")
 	FOnCultivoStateChanged OnStateChanged;
 
@@ -80,6 +83,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cultivo Config")
 	float TiempoAntesDeSecar = 120.0f;
 
+	// Humedad del suelo (0-1) por debajo de la cual necesita riego. Sólo sobre la cuadrícula de UFarmSoilMoistureSubsystem
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cultivo Config")
+	float HumedadMinima = 0.3f;
+
+	// Cada cuánto se actualiza crecimiento/riego (segundos). Lo reparte UFarmFrameBudgetSubsystem
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cultivo Config")
+	float IntervaloActualizacion = 0.1f;
+
 protected:
 	// ============================================================
 	// VISUAL CONFIG - Mantener protected
@@ -115,6 +126,10 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Cultivo State")
 	float TiempoUltimoRiego;
 
+	// Tiempo seguido con el suelo por debajo de HumedadMinima (segundos)
+	UPROPERTY(BlueprintReadOnly, Category = "Cultivo State")
+	float TiempoSinHumedad;
+
 	// Necesita riego ahora mismo
 	UPROPERTY(BlueprintReadOnly, Category = "Cultivo State")
 	bool bNecesitaRiego;
@@ -129,8 +144,13 @@ public:
 	// ============================================================
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
+	// IFarmPoolable
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReturnedToPool() override;
+
 	// ============================================================
 	// GROWTH SYSTEM
 	// ============================================================
@@ -197,12 +217,22 @@ private:
 	// INTERNAL HELPERS
 	// ============================================================
 	
+	// Crecimiento + riego (desde Tick o desde el presupuesto de frame)
+	void UpdateCultivo(float DeltaTime);
+
+	// Alta/baja en contadores y presupuesto de frame (BeginPlay/EndPlay o al salir/volver al pool)
+	void ActivateCultivo();
+	void DeactivateCultivo();
+
 	// Actualizar estado basado en tiempo transcurrido
 	void UpdateGrowthState(float DeltaTime);
 
 	// Actualizar necesidad de riego
 	void UpdateWaterNeed(float DeltaTime);
 
+	// Necesidad de riego a partir de la humedad de la celda del suelo
+	void UpdateWaterNeedFromSoil(float Humedad, float DeltaTime);
+
 	// Cambiar estado y actualizar visual
 	void ChangeState(ECultivoState NewState);
 
@@ -211,4 +241,7 @@ private:
 
 	// Obtener mesh para un estado específico
 	UStaticMesh* GetMeshForState(ECultivoState State) const;
+
+	// Registrado en contadores y presupuesto de frame
+	bool bActivo = false;
 };
\ No newline at end of file
@@ -1,8 +1,22 @@
 #include "DiggableTerrainActor.h"
+#include "MyProject/VR/Diagnostics/FarmDebugDraw.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmDigHistorySubsystem.h"
+#include "MyProject/VR/Subsystems/FarmFrameBudgetSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/DecalComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GameFramework/Pawn.h"
+
+DECLARE_CYCLE_STAT(TEXT("Dig Stamp"), STAT_FarmDigStamp, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Dig History Save"), STAT_FarmDigHistorySave, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Dig History Load"), STAT_FarmDigHistoryLoad, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Dig Chunk Stream In"), STAT_FarmDigChunkStreamIn, STATGROUP_HarvestHaven);
 
 ADiggableTerrainActor::ADiggableTerrainActor()
 {
@@ -29,6 +43,30 @@ void ADiggableTerrainActor::BeginPlay()
     UE_LOG(LogTemp, Warning, TEXT("DiggableTerrain: %s initialized"), *GetName());
     UE_LOG(LogTemp, Warning, TEXT("  - Use Decals: %s"), bUseDecals ? TEXT("YES") : TEXT("NO"));
     UE_LOG(LogTemp, Warning, TEXT("  - Deform Mesh: %s"), bDeformMesh ? TEXT("YES") : TEXT("NO"));
+
+    if (bPersistDigHistory)
+    {
+        LoadDigHistory();
+
+        if (AutosaveInterval > 0.0f)
+        {
+            GetWorldTimerManager().SetTimer(AutosaveTimerHandle, this, 
+                &ADiggableTerrainActor::RequestAutosave, AutosaveInterval, true);
+        }
+    }
+}
+
+void ADiggableTerrainActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (bPersistDigHistory && !SaveDigHistory() && bDigHistoryDirty)
+    {
+        UE_LOG(LogHarvestHaven, Warning, TEXT("DiggableTerrain: %s ended before its dig history loaded; new holes not saved"), *GetName());
+    }
+
+    GetWorldTimerManager().ClearTimer(ChunkStreamTimerHandle);
+    GetWorldTimerManager().ClearTimer(AutosaveTimerHandle);
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void ADiggableTerrainActor::Tick(float DeltaTime)
@@ -38,19 +76,43 @@ void ADiggableTerrainActor::Tick(float DeltaTime)
 
 void ADiggableTerrainActor::OnDig(FVector Location, float Radius, float Depth, FVector ImpactNormal)
 {
+    FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDigStamp);
+
+    // Si el hoyo cae en un chunk guardado que aún no se cargó, cargarlo primero
+    StreamInChunksAround(Location, Radius);
+
     // Verificar si ya hay un hoyo muy cerca
     if (IsLocationAlreadyDug(Location, Radius * 0.5f))
     {
-        UE_LOG(LogTemp, Verbose, TEXT("DiggableTerrain: Location already dug, skipping"));
+        UE_LOG(LogHarvestHaven, VeryVerbose, TEXT("DiggableTerrain: Location already dug, skipping"));
         return;
     }
 
+    FARM_COUNTER_INC(DigStamps);
+    AddHole(FDigHole(Location, Radius, Depth), ImpactNormal);
+    bDigHistoryDirty = true;
+
+    FARM_EVENT(DigStamp, this, static_cast<float>(Location.X), static_cast<float>(Location.Y), static_cast<float>(Location.Z));
+    UE_LOG(LogHarvestHaven, Verbose, TEXT("DiggableTerrain: Dug hole at %s (Total: %d)"), 
+        *Location.ToString(), DigHoles.Num());
+
+    // Debug visual
+    FARM_DEBUG_DRAW(Digging, Sphere, this, Location, Radius, 12, FColor::Orange, 3.0f, 2.0f);
+}
+
+void ADiggableTerrainActor::AddHole(const FDigHole& Hole, const FVector& Normal)
+{
+    FARM_LLM_SCOPE(DigHoles);
+
     // Guardar hoyo
-    DigHoles.Add(FDigHole(Location, Radius, Depth));
+    DigHoles.Add(Hole);
 
     // Limitar número de hoyos
     if (DigHoles.Num() > MaxHoles)
     {
+        // El hoyo descartado tampoco se guarda
+        UE_LOG(LogHarvestHaven, Verbose, TEXT("DiggableTerrain: MaxHoles (%.0f) reached, dropping oldest hole at %s from %s and its dig history"),
+            MaxHoles, *DigHoles[0].Location.ToString(), *GetName());
         DigHoles.RemoveAt(0);
         
         // Remover decal más antiguo
@@ -64,26 +126,22 @@ void ADiggableTerrainActor::OnDig(FVector Location, float Radius, float Depth, F
         }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("DiggableTerrain: Dug hole at %s (Total: %d)"), 
-        *Location.ToString(), DigHoles.Num());
-
     // Crear visualización
     if (bUseDecals)
     {
-        CreateHoleDecal(Location, Radius, ImpactNormal);
+        CreateHoleDecal(Hole.Location, Hole.Radius, Normal);
     }
 
     if (bDeformMesh)
     {
-        DeformMeshAtLocation(Location, Radius, Depth);
+        DeformMeshAtLocation(Hole.Location, Hole.Radius, Hole.Depth);
     }
-
-    // Debug visual
-    DrawDebugSphere(GetWorld(), Location, Radius, 12, FColor::Orange, false, 3.0f, 0, 2.0f);
 }
 
 void ADiggableTerrainActor::CreateHoleDecal(const FVector& Location, float Radius, const FVector& Normal)
 {
+    FARM_LLM_SCOPE(DigHoles);
+
     if (!HoleMaterial)
     {
         UE_LOG(LogTemp, Warning, TEXT("DiggableTerrain: No hole material assigned"));
@@ -132,4 +190,253 @@ bool ADiggableTerrainActor::IsLocationAlreadyDug(const FVector& Location, float
         }
     }
     return false;
+}
+
+// ============================================================
+// PERSISTENCE
+// ============================================================
+
+FString ADiggableTerrainActor::GetPersistenceKey() const
+{
+    if (!PersistenceId.IsEmpty())
+    {
+        return PersistenceId;
+    }
+
+    // Nombre del nivel (sin prefijo de PIE) + nombre del actor
+    const FString LevelName = GetLevel() ? UWorld::RemovePIEPrefix(GetLevel()->GetOuter()->GetName()) : FString();
+    return FString::Printf(TEXT("%s.%s"), *LevelName, *GetName());
+}
+
+bool ADiggableTerrainActor::SaveDigHistory()
+{
+    FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDigHistorySave);
+    FARM_LLM_SCOPE(SaveData);
+
+    // El slot vive en memoria; hasta que termine de cargarse no se guarda (los hoyos siguen pendientes)
+    UFarmDigHistorySubsystem* DigHistory = UFarmDigHistorySubsystem::Get(this);
+    UDigHistorySaveGame* SaveGame = DigHistory && bDigHistoryLoaded ? DigHistory->FindSlot(SaveSlotName) : nullptr;
+    if (!SaveGame)
+    {
+        return false;
+    }
+
+    const FTransform& TerrainTransform = GetActorTransform();
+    FDigTerrainRecord Record;
+    Record.ChunkSize = ChunkSize;
+
+    // Agrupar hoyos por chunk en espacio local del terreno
+    TMap<FIntPoint, TArray<FDigHole>> HolesByChunk;
+    for (const FDigHole& Hole : DigHoles)
+    {
+        const FVector LocalLocation = TerrainTransform.InverseTransformPosition(Hole.Location);
+        HolesByChunk.FindOrAdd(FDigHistoryCodec::GetChunkCoord(LocalLocation, ChunkSize))
+            .Add(FDigHole(LocalLocation, Hole.Radius, Hole.Depth));
+    }
+
+    // Chunks que nunca se cargaron: se copian comprimidos tal cual
+    for (const TPair<FIntPoint, FDigChunkRecord>& Pending : PendingChunks)
+    {
+        if (FMath::IsNearlyEqual(PendingChunkSize, ChunkSize))
+        {
+            Record.Chunks.Add(Pending.Value);
+            continue;
+        }
+
+        // Cambió el tamaño de chunk: recodificar
+        TArray<FDigHole> LocalHoles;
+        if (FDigHistoryCodec::DecodeChunk(Pending.Value, PendingChunkSize, LocalHoles))
+        {
+            for (const FDigHole& Hole : LocalHoles)
+            {
+                HolesByChunk.FindOrAdd(FDigHistoryCodec::GetChunkCoord(Hole.Location, ChunkSize)).Add(Hole);
+            }
+        }
+    }
+
+    for (const TPair<FIntPoint, TArray<FDigHole>>& Chunk : HolesByChunk)
+    {
+        FDigChunkRecord ChunkRecord;
+        if (FDigHistoryCodec::EncodeChunk(Chunk.Value, Chunk.Key, ChunkSize, ChunkRecord))
+        {
+            Record.Chunks.Add(MoveTemp(ChunkRecord));
+        }
+    }
+
+    const FString Key = GetPersistenceKey();
+    UE_LOG(LogTemp, Log, TEXT("DiggableTerrain: Saving %d holes in %d chunks for %s"), 
+        DigHoles.Num(), Record.Chunks.Num(), *Key);
+
+    SaveGame->Terrains.Add(Key, MoveTemp(Record));
+    DigHistory->SaveSlot(SaveSlotName);
+
+    bDigHistoryDirty = false;
+    return true;
+}
+
+void ADiggableTerrainActor::RequestAutosave()
+{
+    if (!bDigHistoryDirty || bAutosaveQueued)
+    {
+        return;
+    }
+
+    // La codificación de los chunks sigue en el game thread: se encola para no coincidir con otro
+    // trabajo pesado en el mismo frame (el disco se escribe en segundo plano)
+    if (UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this))
+    {
+        bAutosaveQueued = true;
+        FrameBudget->EnqueueWork(EFarmWorkSystem::Autosave, this, [WeakThis = TWeakObjectPtr<ADiggableTerrainActor>(this)]()
+        {
+            ADiggableTerrainActor* Terrain = WeakThis.Get();
+            if (!Terrain)
+            {
+                return;
+            }
+
+            Terrain->bAutosaveQueued = false;
+            Terrain->SaveDigHistory();
+        });
+        return;
+    }
+
+    SaveDigHistory();
+}
+
+bool ADiggableTerrainActor::LoadDigHistory()
+{
+    UFarmDigHistorySubsystem* DigHistory = UFarmDigHistorySubsystem::Get(this);
+    if (!DigHistory)
+    {
+        return false;
+    }
+
+    DigHistory->LoadSlot(SaveSlotName, FOnDigHistorySlotLoaded::CreateWeakLambda(this, [this](UDigHistorySaveGame* SaveGame)
+    {
+        // La carga puede terminar después de EndPlay
+        if (HasActorBegunPlay())
+        {
+            ApplyDigHistory(SaveGame);
+        }
+    }));
+    return true;
+}
+
+void ADiggableTerrainActor::ApplyDigHistory(const UDigHistorySaveGame* SaveGame)
+{
+    FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDigHistoryLoad);
+    FARM_LLM_SCOPE(SaveData);
+
+    PendingChunks.Reset();
+    bDigHistoryLoaded = SaveGame != nullptr;
+
+    const FDigTerrainRecord* Record = SaveGame ? SaveGame->Terrains.Find(GetPersistenceKey()) : nullptr;
+    if (!Record || Record->ChunkSize <= 0.0f)
+    {
+        return;
+    }
+
+    // Solo se guardan los blobs comprimidos; se descomprimen al acercarse el jugador.
+    // Se copian: el registro del slot compartido se sigue escribiendo mientras no se guarde este terreno
+    PendingChunkSize = Record->ChunkSize;
+    for (const FDigChunkRecord& Chunk : Record->Chunks)
+    {
+        PendingChunks.Add(Chunk.ChunkCoord, Chunk);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("DiggableTerrain: Loaded %d dig chunks for %s"), 
+        PendingChunks.Num(), *GetPersistenceKey());
+
+    if (PendingChunks.Num() > 0)
+    {
+        GetWorldTimerManager().SetTimer(ChunkStreamTimerHandle, this, 
+            &ADiggableTerrainActor::StreamInNearbyChunks, ChunkStreamCheckInterval, true, 0.0f);
+    }
+}
+
+void ADiggableTerrainActor::StreamInNearbyChunks()
+{
+    if (PendingChunks.Num() == 0)
+    {
+        GetWorldTimerManager().ClearTimer(ChunkStreamTimerHandle);
+        return;
+    }
+
+    if (const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0))
+    {
+        StreamInChunksAround(PlayerPawn->GetActorLocation(), ChunkStreamInRadius, true);
+    }
+}
+
+void ADiggableTerrainActor::StreamInChunksAround(const FVector& Location, float Radius, bool bDeferToFrameBudget)
+{
+    if (PendingChunks.Num() == 0 || PendingChunkSize <= 0.0f)
+    {
+        return;
+    }
+
+    const FVector LocalLocation = GetActorTransform().InverseTransformPosition(Location);
+    const float LocalRadius = Radius / FMath::Max(GetActorScale3D().GetAbsMax(), KINDA_SMALL_NUMBER);
+
+    const FIntPoint MinChunk = FDigHistoryCodec::GetChunkCoord(LocalLocation - FVector(LocalRadius), PendingChunkSize);
+    const FIntPoint MaxChunk = FDigHistoryCodec::GetChunkCoord(LocalLocation + FVector(LocalRadius), PendingChunkSize);
+
+    // Al cavar el chunk se necesita ya; por proximidad se descomprime uno por turno
+    UFarmFrameBudgetSubsystem* FrameBudget = bDeferToFrameBudget ? UFarmFrameBudgetSubsystem::Get(this) : nullptr;
+
+    for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+    {
+        for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+        {
+            const FIntPoint ChunkCoord(X, Y);
+            if (!PendingChunks.Contains(ChunkCoord))
+            {
+                continue;
+            }
+
+            if (!FrameBudget)
+            {
+                StreamInChunk(ChunkCoord);
+            }
+            else if (!QueuedChunks.Contains(ChunkCoord))
+            {
+                QueuedChunks.Add(ChunkCoord);
+                FrameBudget->EnqueueWork(EFarmWorkSystem::DigStreaming, this, [WeakThis = TWeakObjectPtr<ADiggableTerrainActor>(this), ChunkCoord]()
+                {
+                    if (ADiggableTerrainActor* Terrain = WeakThis.Get())
+                    {
+                        Terrain->QueuedChunks.Remove(ChunkCoord);
+                        Terrain->StreamInChunk(ChunkCoord);
+                    }
+                });
+            }
+        }
+    }
+}
+
+void ADiggableTerrainActor::StreamInChunk(const FIntPoint& ChunkCoord)
+{
+    FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDigChunkStreamIn);
+
+    FDigChunkRecord Record;
+    if (!PendingChunks.RemoveAndCopyValue(ChunkCoord, Record))
+    {
+        return;
+    }
+
+    TArray<FDigHole> LocalHoles;
+    if (!FDigHistoryCodec::DecodeChunk(Record, PendingChunkSize, LocalHoles))
+    {
+        return;
+    }
+
+    const FTransform& TerrainTransform = GetActorTransform();
+    for (const FDigHole& LocalHole : LocalHoles)
+    {
+        AddHole(FDigHole(TerrainTransform.TransformPosition(LocalHole.Location), LocalHole.Radius, LocalHole.Depth),
+            -TerrainTransform.GetUnitAxis(EAxis::Z));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("DiggableTerrain: Streamed in chunk (%d, %d) with %d holes"), 
+        ChunkCoord.X, ChunkCoord.Y, LocalHoles.Num());
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "MyProject/VR/Gameplay/DigHistorySaveGame.h"
 #include "DiggableTerrainActor.generated.h"
 
 USTRUCT(BlueprintType)
@@ -46,6 +47,7 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config")
 	UMaterialInterface* HoleMaterial;
 
+	// Hoyos visibles a la vez; al pasarse se borra el más antiguo, también del historial guardado
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config")
 	float MaxHoles = 50;
 
@@ -55,6 +57,32 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config")
 	bool bDeformMesh = false;
 
+	// Persistencia
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence")
+	bool bPersistDigHistory = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence")
+	FString SaveSlotName = TEXT("DigHistory");
+
+	// Identificador del terreno en el save (vacío = nombre del actor en su nivel)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence")
+	FString PersistenceId;
+
+	// Tamaño de chunk en espacio local del terreno (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence", meta = (ClampMin = "100.0", ClampMax = "30000.0"))
+	float ChunkSize = 1000.0f;
+
+	// Los chunks guardados se descomprimen cuando el jugador entra en este radio
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence")
+	float ChunkStreamInRadius = 3000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence")
+	float ChunkStreamCheckInterval = 0.5f;
+
+	// Guardado automático de los hoyos nuevos (segundos, 0 = solo al salir)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Persistence")
+	float AutosaveInterval = 60.0f;
+
 	// Estado
 	UPROPERTY()
 	TArray<FDigHole> DigHoles;
@@ -62,15 +90,55 @@ protected:
 	UPROPERTY()
 	TArray<UDecalComponent*> DecalComponents;
 
+	// Chunks cargados del save que todavía no se han descomprimido
+	TMap<FIntPoint, FDigChunkRecord> PendingChunks;
+
+	// Tamaño de chunk con el que se codificaron los PendingChunks
+	float PendingChunkSize = 0.0f;
+
+	// Chunks ya encolados en el presupuesto de frame
+	TSet<FIntPoint> QueuedChunks;
+
+	FTimerHandle ChunkStreamTimerHandle;
+	FTimerHandle AutosaveTimerHandle;
+
+	// Hay hoyos sin guardar / el guardado ya está encolado
+	bool bDigHistoryDirty = false;
+	bool bAutosaveQueued = false;
+
+	// El slot ya está en memoria; antes no se puede guardar sin pisar lo que hay en disco
+	bool bDigHistoryLoaded = false;
+
 public:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Digging")
 	void OnDig(FVector Location, float Radius, float Depth, FVector ImpactNormal);
 
+	// Guarda los hoyos como deltas comprimidos por chunk; la escritura en disco es asíncrona
+	UFUNCTION(BlueprintCallable, Category = "Digging Persistence")
+	bool SaveDigHistory();
+
+	// Carga los chunks comprimidos en segundo plano; se descomprimen bajo demanda
+	UFUNCTION(BlueprintCallable, Category = "Digging Persistence")
+	bool LoadDigHistory();
+
+	UFUNCTION(BlueprintPure, Category = "Digging Persistence")
+	int32 GetPendingChunkCount() const { return PendingChunks.Num(); }
+
 private:
+	void AddHole(const FDigHole& Hole, const FVector& Normal);
 	void CreateHoleDecal(const FVector& Location, float Radius, const FVector& Normal);
 	void DeformMeshAtLocation(const FVector& Location, float Radius, float Depth);
 	bool IsLocationAlreadyDug(const FVector& Location, float MinDistance = 10.0f) const;
+
+	// Persistencia
+	FString GetPersistenceKey() const;
+	void StreamInNearbyChunks();
+	void StreamInChunk(const FIntPoint& ChunkCoord);
+	void StreamInChunksAround(const FVector& Location, float Radius, bool bDeferToFrameBudget = false);
+	void RequestAutosave();
+	void ApplyDigHistory(const UDigHistorySaveGame* SaveGame);
 };
\ No newline at end of file
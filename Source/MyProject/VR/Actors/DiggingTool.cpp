@@ -1,13 +1,20 @@
 #include "DiggingTool.h"
 #include "MyProject/VR/Components/VRGrabComponent.h"
 #include "MyProject/VR/Components/VRDiggingToolComponent.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
 #include "ParcelaTierra.h"
+#include "ParcelaFieldActor.h"
 #include "Components/StaticMeshComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
+DECLARE_CYCLE_STAT(TEXT("Digging Tool Tick"), STAT_FarmDiggingToolTick, STATGROUP_HarvestHaven);
+
 ADiggingTool::ADiggingTool()
 {
+	FARM_LLM_SCOPE(Grabbables);
+
 	PrimaryActorTick.bCanEverTick = true; // ← CAMBIADO: Necesitamos tick para detectar parcelas
 
 	// Handle (mango)
@@ -66,6 +73,8 @@ void ADiggingTool::BeginPlay()
 // ===== NUEVO: TICK PARA DETECTAR PARCELAS =====
 void ADiggingTool::Tick(float DeltaTime)
 {
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDiggingToolTick);
+
 	Super::Tick(DeltaTime);
 
 	// Solo verificar si la pala está agarrada
@@ -100,14 +109,14 @@ void ADiggingTool::CheckForNearbyParcela()
 	FVector End = Start + FVector(0, 0, -100.0f); // Raycast hacia abajo
 
 	// Configurar parámetros de colisión
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DiggingToolParcelaProbe), false, this);
 	QueryParams.AddIgnoredActor(GetOwner());
 	QueryParams.bTraceComplex = false;
 
 	FHitResult HitResult;
 
 	// Hacer raycast
+	FARM_COUNTER_INC(SceneQueries);
 	bool bHit = GetWorld()->LineTraceSingleByChannel(
 		HitResult,
 		Start,
@@ -125,6 +134,14 @@ void ADiggingTool::CheckForNearbyParcela()
 		{
 			OnParcelaDetected(Parcela);
 		}
+		else if (AParcelaFieldActor* Field = Cast<AParcelaFieldActor>(HitResult.GetActor()))
+		{
+			// En un campo de parcelas la instancia golpeada es la celda
+			if (Field->CanBePrepared(HitResult.Item) && Field->PrepareGround(HitResult.Item))
+			{
+				LastParcelaCheckTime = GetWorld()->GetTimeSeconds() + 1.0f; // Cooldown de 1 segundo
+			}
+		}
 	}
 }
 
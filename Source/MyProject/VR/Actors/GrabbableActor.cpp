@@ -1,9 +1,12 @@
 #include "GrabbableActor.h"
 #include "MyProject/VR/Components/VRGrabComponent.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
 #include "Components/StaticMeshComponent.h"
 
 AGrabbableActor::AGrabbableActor()
 {
+	FARM_LLM_SCOPE(Grabbables);
+
 	PrimaryActorTick.bCanEverTick = false;
 
 	// Create mesh component
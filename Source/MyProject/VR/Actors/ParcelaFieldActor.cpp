@@ -0,0 +1,288 @@
+// ==================================================================
+// ParcelaFieldActor.cpp
+// Implementación del campo de parcelas en cuadrícula
+// ==================================================================
+
+#include "ParcelaFieldActor.h"
+#include "Cultivo.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/GameModes/HarvestHavenGameManager.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmEventBusSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmSoilMoistureSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+
+AParcelaFieldActor::AParcelaFieldActor()
+{
+	FARM_LLM_SCOPE(Parcels);
+
+	// Sin tick: sólo cambia cuando se prepara, planta o cosecha
+	PrimaryActorTick.bCanEverTick = false;
+
+	ParcelInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("ParcelInstances"));
+	RootComponent = ParcelInstances;
+	ParcelInstances->SetCollisionProfileName(TEXT("BlockAll"));
+
+	// Custom data 0 = EParcelaState
+	ParcelInstances->NumCustomDataFloats = 1;
+
+	ParcelMesh = nullptr;
+
+	// Tag para identificación (igual que AParcelaTierra)
+	Tags.Add(FName("Parcela"));
+}
+
+void AParcelaFieldActor::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	BuildInstances();
+}
+
+void AParcelaFieldActor::BeginPlay()
+{
+	FARM_LLM_SCOPE(Parcels);
+
+	Super::BeginPlay();
+
+	const int32 NumCells = GetNumCells();
+	if (ParcelInstances->GetInstanceCount() != NumCells)
+	{
+		BuildInstances();
+	}
+
+	CellStates.Init(EParcelaState::SinPreparar, NumCells);
+	CellCultivos.Init(nullptr, NumCells);
+	CellStateTimes.Init(GetWorld()->GetTimeSeconds(), NumCells);
+
+	// Campos spawneados después de empezar el juego: ampliar la rejilla de humedad si hace falta
+	if (UFarmSoilMoistureSubsystem* SoilMoisture = UFarmSoilMoistureSubsystem::Get(this))
+	{
+		SoilMoisture->NotifyParcelaAdded(this);
+	}
+
+	UE_LOG(LogHarvestHaven, Log, TEXT("ParcelaField: %s initialized - %dx%d cells"), *GetName(), Columns, Rows);
+}
+
+// ============================================================
+// CELLS
+// ============================================================
+
+int32 AParcelaFieldActor::GetCellIndex(int32 Column, int32 Row) const
+{
+	if (Column < 0 || Column >= Columns || Row < 0 || Row >= Rows)
+	{
+		return INDEX_NONE;
+	}
+
+	return Row * Columns + Column;
+}
+
+int32 AParcelaFieldActor::GetCellAt(const FVector& WorldLocation) const
+{
+	if (CellSize <= 0.0f)
+	{
+		return INDEX_NONE;
+	}
+
+	// Las celdas están centradas en (Columna, Fila) * CellSize en espacio local
+	const FVector LocalLocation = GetActorTransform().InverseTransformPosition(WorldLocation);
+	const int32 Column = FMath::RoundToInt(LocalLocation.X / CellSize);
+	const int32 Row = FMath::RoundToInt(LocalLocation.Y / CellSize);
+
+	return GetCellIndex(Column, Row);
+}
+
+FVector AParcelaFieldActor::GetCellLocation(int32 Cell) const
+{
+	const FVector LocalLocation((Cell % FMath::Max(Columns, 1)) * CellSize, (Cell / FMath::Max(Columns, 1)) * CellSize, 0.0f);
+	return GetActorTransform().TransformPosition(LocalLocation);
+}
+
+FVector AParcelaFieldActor::GetCultivoSpawnLocation(int32 Cell) const
+{
+	return GetCellLocation(Cell) + GetActorRotation().RotateVector(CultivoOffset);
+}
+
+float AParcelaFieldActor::GetTimeInState(int32 Cell) const
+{
+	if (!CellStateTimes.IsValidIndex(Cell) || !GetWorld())
+	{
+		return 0.0f;
+	}
+
+	return GetWorld()->GetTimeSeconds() - CellStateTimes[Cell];
+}
+
+// ============================================================
+// PREPARATION SYSTEM
+// ============================================================
+
+bool AParcelaFieldActor::PrepareGround(int32 Cell)
+{
+	FARM_TRACE_EVENT_SCOPE(Farm_PrepareGround);
+
+	if (!CanBePrepared(Cell))
+	{
+		UE_LOG(LogHarvestHaven, Verbose, TEXT("ParcelaField: Cannot prepare cell %d - State: %s"),
+			Cell, *UEnum::GetValueAsString(GetCellState(Cell)));
+		return false;
+	}
+
+	ChangeCellState(Cell, EParcelaState::Preparada);
+	return true;
+}
+
+// ============================================================
+// PLANTING SYSTEM
+// ============================================================
+
+bool AParcelaFieldActor::PlantCrop(int32 Cell, TSubclassOf<ACultivo> CultivoClass, ECultivoType TipoCultivo)
+{
+	FARM_TRACE_EVENT_SCOPE(Farm_PlantCrop);
+
+	if (!CanPlant(Cell))
+	{
+		UE_LOG(LogHarvestHaven, Verbose, TEXT("ParcelaField: Cannot plant cell %d - State: %s"),
+			Cell, *UEnum::GetValueAsString(GetCellState(Cell)));
+		return false;
+	}
+
+	if (!CultivoClass)
+	{
+		UE_LOG(LogHarvestHaven, Error, TEXT("ParcelaField: Cultivo class is null!"));
+		return false;
+	}
+
+	FARM_LLM_SCOPE(Crops);
+	ACultivo* NewCultivo = UFarmActorPoolSubsystem::Acquire<ACultivo>(
+		this,
+		CultivoClass,
+		FTransform(GetActorRotation(), GetCultivoSpawnLocation(Cell)),
+		this
+	);
+
+	if (!NewCultivo)
+	{
+		UE_LOG(LogHarvestHaven, Error, TEXT("ParcelaField: Failed to spawn cultivo!"));
+		return false;
+	}
+
+	// Configurar cultivo
+	NewCultivo->TipoCultivo = TipoCultivo;
+
+	if (AHarvestHavenGameManager* GameManager = Cast<AHarvestHavenGameManager>(
+		UGameplayStatics::GetGameMode(this)))
+	{
+		FCropInfo Info = GameManager->GetCropInfo(TipoCultivo);
+		NewCultivo->TiempoCrecimientoSegundos = Info.GrowthTimeSeconds;
+		NewCultivo->ValorCosecha = Info.SellPrice;
+	}
+
+	NewCultivo->StartGrowth();
+
+	CellCultivos[Cell] = NewCultivo;
+	ChangeCellState(Cell, EParcelaState::ConCultivo);
+
+	FFarmBusEvent Planted(EFarmBusEvent::CultivoPlanted, this, Cell);
+	Planted.Subject = NewCultivo;
+	UFarmEventBusSubsystem::Post(this, Planted);
+
+	return true;
+}
+
+// ============================================================
+// HARVEST SYSTEM
+// ============================================================
+
+bool AParcelaFieldActor::HarvestCrop(int32 Cell, int32& OutValue)
+{
+	FARM_TRACE_EVENT_SCOPE(Farm_HarvestCrop);
+
+	OutValue = 0;
+
+	ACultivo* Cultivo = GetCellCultivo(Cell);
+	if (!Cultivo)
+	{
+		UE_LOG(LogHarvestHaven, Verbose, TEXT("ParcelaField: No crop to harvest in cell %d"), Cell);
+		return false;
+	}
+
+	if (!Cultivo->TryHarvest(OutValue))
+	{
+		return false;
+	}
+
+	ClearParcela(Cell);
+	return true;
+}
+
+void AParcelaFieldActor::ClearParcela(int32 Cell)
+{
+	if (!IsValidCell(Cell))
+	{
+		return;
+	}
+
+	// Devolver cultivo al pool si existe
+	if (IsValid(CellCultivos[Cell]))
+	{
+		UFarmActorPoolSubsystem::Release(CellCultivos[Cell]);
+	}
+
+	CellCultivos[Cell] = nullptr;
+
+	// Volver a estado preparada (mantener el surco)
+	ChangeCellState(Cell, EParcelaState::Preparada);
+}
+
+// ============================================================
+// INTERNAL HELPERS
+// ============================================================
+
+void AParcelaFieldActor::BuildInstances()
+{
+	ParcelInstances->SetStaticMesh(ParcelMesh);
+	ParcelInstances->ClearInstances();
+
+	const int32 NumCells = GetNumCells();
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(NumCells);
+	for (int32 Cell = 0; Cell < NumCells; ++Cell)
+	{
+		Transforms.Emplace(FVector((Cell % Columns) * CellSize, (Cell / Columns) * CellSize, 0.0f));
+	}
+
+	// Transformaciones locales; el custom data arranca a 0 = SinPreparar
+	ParcelInstances->AddInstances(Transforms, false, false);
+}
+
+void AParcelaFieldActor::ChangeCellState(int32 Cell, EParcelaState NewState)
+{
+	const EParcelaState OldState = CellStates[Cell];
+	if (NewState == OldState)
+	{
+		return;
+	}
+
+	FARM_TRACE_EVENT_SCOPE(Farm_ParcelaStateChange);
+
+	CellStates[Cell] = NewState;
+	CellStateTimes[Cell] = GetWorld()->GetTimeSeconds();
+
+	// El material elige el aspecto: sin cambio de mesh ni de componente
+	ParcelInstances->SetCustomDataValue(Cell, 0, static_cast<float>(NewState), true);
+
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::ParcelaStateChanged, this, Cell, static_cast<int32>(NewState)));
+
+	FARM_EVENT(ParcelaStateChanged, this, static_cast<float>(OldState), static_cast<float>(NewState), static_cast<float>(Cell));
+	UE_LOG(LogHarvestHaven, Verbose, TEXT("ParcelaField: Cell %d state changed %s -> %s"),
+		Cell,
+		*UEnum::GetValueAsString(OldState),
+		*UEnum::GetValueAsString(NewState));
+}
\ No newline at end of file
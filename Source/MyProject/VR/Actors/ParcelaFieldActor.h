@@ -0,0 +1,170 @@
+// ==================================================================
+// ParcelaFieldActor.h
+// Campo de parcelas en cuadrícula: un actor, estado en arrays por celda
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MyProject/VR/Actors/ParcelaTierra.h"
+#include "MyProject/VR/Gameplay/GameplayTypes.h"
+#include "ParcelaFieldActor.generated.h"
+
+class UInstancedStaticMeshComponent;
+class ACultivo;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnParcelaFieldStateChanged, int32, Cell, EParcelaState, NewState);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnParcelaFieldCultivoPlanted, int32, Cell, ACultivo*, PlantedCultivo);
+
+/**
+ * Campo de Columns x Rows parcelas en un solo actor.
+ * Mismo flujo que AParcelaTierra (preparar -> plantar -> cosechar) pero por índice de celda:
+ * - El estado, el cultivo y la hora del último cambio viven en arrays contiguos por celda
+ * - Se dibuja con un ISM, una instancia por celda (instancia == celda); el estado va en el
+ *   custom data 0 de la instancia y el material elige el aspecto (0 sin preparar, 1 surco, 2 con cultivo)
+ * - Un trazo contra el campo devuelve la celda en HitResult.Item
+ */
+UCLASS()
+class MYPROJECT_API AParcelaFieldActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AParcelaFieldActor();
+
+	// ============================================================
+	// EVENTS
+	// ============================================================
+
+	// Para Blueprint: los dispara UFarmEventBusSubsystem al final del frame, uno por celda
+	UPROPERTY(BlueprintAssignable, Category = "Parcela Field Events")
+	FOnParcelaFieldStateChanged OnCellStateChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "Parcela Field Events")
+	FOnParcelaFieldCultivoPlanted OnCellCultivoPlanted;
+
+protected:
+	// ============================================================
+	// COMPONENTS
+	// ============================================================
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	UInstancedStaticMeshComponent* ParcelInstances;
+
+	// ============================================================
+	// CONFIG
+	// ============================================================
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parcela Field Config", meta = (ClampMin = "1"))
+	int32 Columns = 100;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parcela Field Config", meta = (ClampMin = "1"))
+	int32 Rows = 100;
+
+	// Separación entre centros de celda (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parcela Field Config")
+	float CellSize = 150.0f;
+
+	// Mesh de parcela; su material lee el estado del custom data
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parcela Field Config")
+	UStaticMesh* ParcelMesh;
+
+	// Punto del cultivo respecto al centro de la celda (igual que CultivoSpawnPoint en AParcelaTierra)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parcela Field Config")
+	FVector CultivoOffset = FVector(0.0f, 0.0f, 10.0f);
+
+	// ============================================================
+	// STATE (structure of arrays, índice = celda)
+	// ============================================================
+
+	TArray<EParcelaState> CellStates;
+
+	UPROPERTY(Transient)
+	TArray<ACultivo*> CellCultivos;
+
+	// Tiempo de mundo del último cambio de estado
+	TArray<float> CellStateTimes;
+
+public:
+	// ============================================================
+	// LIFECYCLE
+	// ============================================================
+
+	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void BeginPlay() override;
+
+	// ============================================================
+	// CELLS
+	// ============================================================
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	int32 GetNumCells() const { return Columns * Rows; }
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	bool IsValidCell(int32 Cell) const { return CellStates.IsValidIndex(Cell); }
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	int32 GetCellIndex(int32 Column, int32 Row) const;
+
+	// Celda bajo una posición del mundo (INDEX_NONE fuera del campo)
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	int32 GetCellAt(const FVector& WorldLocation) const;
+
+	// Centro de la celda en el mundo
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	FVector GetCellLocation(int32 Cell) const;
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	FVector GetCultivoSpawnLocation(int32 Cell) const;
+
+	// ============================================================
+	// PREPARATION / PLANTING / HARVEST (mismo API que AParcelaTierra)
+	// ============================================================
+
+	UFUNCTION(BlueprintCallable, Category = "Parcela Field")
+	bool PrepareGround(int32 Cell);
+
+	UFUNCTION(BlueprintCallable, Category = "Parcela Field")
+	bool PlantCrop(int32 Cell, TSubclassOf<ACultivo> CultivoClass, ECultivoType TipoCultivo);
+
+	UFUNCTION(BlueprintCallable, Category = "Parcela Field")
+	bool HarvestCrop(int32 Cell, int32& OutValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Parcela Field")
+	void ClearParcela(int32 Cell);
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	bool CanBePrepared(int32 Cell) const { return IsValidCell(Cell) && CellStates[Cell] == EParcelaState::SinPreparar; }
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	bool CanPlant(int32 Cell) const { return IsValidCell(Cell) && CellStates[Cell] == EParcelaState::Preparada; }
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	bool HasCultivo(int32 Cell) const { return GetCellCultivo(Cell) != nullptr; }
+
+	// ============================================================
+	// GETTERS
+	// ============================================================
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	EParcelaState GetCellState(int32 Cell) const { return IsValidCell(Cell) ? CellStates[Cell] : EParcelaState::SinPreparar; }
+
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	ACultivo* GetCellCultivo(int32 Cell) const { return CellCultivos.IsValidIndex(Cell) ? CellCultivos[Cell] : nullptr; }
+
+	// Segundos desde el último cambio de estado de la celda
+	UFUNCTION(BlueprintPure, Category = "Parcela Field")
+	float GetTimeInState(int32 Cell) const;
+
+private:
+	// ============================================================
+	// INTERNAL HELPERS
+	// ============================================================
+
+	// Una instancia por celda, en orden de celda
+	void BuildInstances();
+
+	// Cambiar estado de una celda y su custom data
+	void ChangeCellState(int32 Cell, EParcelaState NewState);
+};
\ No newline at end of file
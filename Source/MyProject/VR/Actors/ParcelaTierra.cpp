@@ -2,9 +2,18 @@
 #include "Cultivo.h"
 #include "Kismet/GameplayStatics.h"
 #include "MyProject/VR/GameModes/HarvestHavenGameManager.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmEventBusSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmSoilMoistureSubsystem.h"
 
 AParcelaTierra::AParcelaTierra()
 {
+	FARM_LLM_SCOPE(Parcels);
+
 	PrimaryActorTick.bCanEverTick = false;
 
 	// Crear mesh de tierra
@@ -27,11 +36,19 @@ AParcelaTierra::AParcelaTierra()
 
 void AParcelaTierra::BeginPlay()
 {
+	FARM_LLM_SCOPE(Parcels);
+
 	Super::BeginPlay();
 
 	// Configurar mesh inicial
 	UpdateVisualMesh();
 
+	// Parcelas spawneadas después de empezar el juego: ampliar la rejilla de humedad si hace falta
+	if (UFarmSoilMoistureSubsystem* SoilMoisture = UFarmSoilMoistureSubsystem::Get(this))
+	{
+		SoilMoisture->NotifyParcelaAdded(this);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("ParcelaTierra: Initialized at %s"), 
 		*GetActorLocation().ToString());
 }
@@ -42,6 +59,8 @@ void AParcelaTierra::BeginPlay()
 
 bool AParcelaTierra::PrepareGround()
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_PrepareGround);
+
 	// Verificar si se puede preparar
 	if (!CanBePrepared())
 	{
@@ -63,6 +82,8 @@ bool AParcelaTierra::PrepareGround()
 
 bool AParcelaTierra::PlantCrop(TSubclassOf<ACultivo> CultivoClass, ECultivoType TipoCultivo)
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_PlantCrop);
+
 	// Verificar condiciones
 	if (!CanPlant())
 	{
@@ -77,19 +98,16 @@ bool AParcelaTierra::PlantCrop(TSubclassOf<ACultivo> CultivoClass, ECultivoType
 		return false;
 	}
 
-	// Spawn cultivo en el punto designado
+	// Cultivo del pool (sólo se spawnea si está vacío) en el punto designado
 	FVector SpawnLocation = GetCultivoSpawnLocation();
 	FRotator SpawnRotation = GetActorRotation();
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = this;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	ACultivo* NewCultivo = GetWorld()->SpawnActor<ACultivo>(
+	FARM_LLM_SCOPE(Crops);
+	ACultivo* NewCultivo = UFarmActorPoolSubsystem::Acquire<ACultivo>(
+		this,
 		CultivoClass,
-		SpawnLocation,
-		SpawnRotation,
-		SpawnParams
+		FTransform(SpawnRotation, SpawnLocation),
+		this
 	);
 
 	if (!NewCultivo)
@@ -117,8 +135,10 @@ bool AParcelaTierra::PlantCrop(TSubclassOf<ACultivo> CultivoClass, ECultivoType
 	CurrentCultivo = NewCultivo;
 	ChangeState(EParcelaState::ConCultivo);
 
-	// Broadcast evento
-	OnCultivoPlanted.Broadcast(NewCultivo);
+	// Evento
+	FFarmBusEvent Planted(EFarmBusEvent::CultivoPlanted, this);
+	Planted.Subject = NewCultivo;
+	UFarmEventBusSubsystem::Post(this, Planted);
 
 	UE_LOG(LogTemp, Log, TEXT("ParcelaTierra: Cultivo planted successfully - Type: %s"), 
 		*UEnum::GetValueAsString(TipoCultivo));
@@ -143,6 +163,8 @@ FVector AParcelaTierra::GetCultivoSpawnLocation() const
 
 bool AParcelaTierra::HarvestCrop(int32& OutValue)
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_HarvestCrop);
+
 	OutValue = 0;
 
 	// Verificar que hay cultivo
@@ -169,10 +191,10 @@ bool AParcelaTierra::HarvestCrop(int32& OutValue)
 
 void AParcelaTierra::ClearParcela()
 {
-	// Destruir cultivo si existe
+	// Devolver cultivo al pool si existe
 	if (CurrentCultivo && IsValid(CurrentCultivo))
 	{
-		CurrentCultivo->Destroy();
+		UFarmActorPoolSubsystem::Release(CurrentCultivo);
 	}
 
 	CurrentCultivo = nullptr;
@@ -194,16 +216,19 @@ void AParcelaTierra::ChangeState(EParcelaState NewState)
 		return;
 	}
 
+	FARM_TRACE_EVENT_SCOPE(Farm_ParcelaStateChange);
+
 	EParcelaState OldState = CurrentState;
 	CurrentState = NewState;
 
 	// Actualizar visual
 	UpdateVisualMesh();
 
-	// Broadcast evento
-	OnStateChanged.Broadcast(CurrentState);
+	// Evento
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::ParcelaStateChanged, this, INDEX_NONE, static_cast<int32>(CurrentState)));
 
-	UE_LOG(LogTemp, Log, TEXT("ParcelaTierra: State changed %s -> %s"), 
+	FARM_EVENT(ParcelaStateChanged, this, static_cast<float>(OldState), static_cast<float>(NewState));
+	UE_LOG(LogHarvestHaven, Verbose, TEXT("ParcelaTierra: State changed %s -> %s"), 
 		*UEnum::GetValueAsString(OldState), 
 		*UEnum::GetValueAsString(CurrentState));
 }
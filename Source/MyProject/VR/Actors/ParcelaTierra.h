@@ -38,6 +38,7 @@ public:
 	// EVENTS
 	// ============================================================
 	
+	// Para Blueprint: los dispara UFarmEventBusSubsystem al final del frame
 	UPROPERTY(BlueprintAssignable, Category = "Parcela Events")
 	FOnParcelaStateChanged OnStateChanged;
 
@@ -5,15 +5,30 @@
 
 #include "SeedItem.h"
 #include "ParcelaTierra.h"
+#include "ParcelaFieldActor.h"
 #include "Cultivo.h"
 #include "MyProject/VR/Components/VRGrabComponent.h"
+#include "MyProject/VR/Diagnostics/FarmDebugDraw.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
 #include "MyProject/VR/GameModes/HarvestHavenGameManager.h"
+#include "MyProject/VR/Subsystems/FarmFrameBudgetSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Seed Tick"), STAT_FarmSeedTick, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Seed Parcela Scan"), STAT_FarmSeedParcelaScan, STATGROUP_HarvestHaven);
+
+// Cada cuánto se busca parcela plantable (segundos)
+static constexpr float PlantingCheckInterval = 0.2f;
 
 ASeedItem::ASeedItem()
 {
+	FARM_LLM_SCOPE(Grabbables);
+
 	PrimaryActorTick.bCanEverTick = true;
 
 	// Crear mesh de semilla (pequeño objeto)
@@ -55,30 +70,101 @@ void ASeedItem::BeginPlay()
 		GrabComponent->OnToolReleased.AddDynamic(this, &ASeedItem::OnReleased);
 	}
 
+	// Las precalentadas esperan en el pool sin verificar nada
+	if (!UFarmActorPoolSubsystem::IsPooled(this))
+	{
+		StartPlantingChecks();
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("SeedItem: %s ready - Type: %s"), 
 		*GetName(), 
 		*UEnum::GetValueAsString(CultivoType));
 }
 
-void ASeedItem::Tick(float DeltaTime)
+void ASeedItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	StopPlantingChecks();
+	GetWorldTimerManager().ClearTimer(ReturnToPoolTimerHandle);
 
-	// Solo verificar cuando está siendo soltada o está cerca del suelo
-	if (bWasPlanted)
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASeedItem::OnAcquiredFromPool()
+{
+	if (GrabComponent)
 	{
-		return; // Ya fue plantada, no hacer nada más
+		GrabComponent->SetPooled(false);
+	}
+
+	StartPlantingChecks();
+}
+
+void ASeedItem::OnReturnedToPool()
+{
+	StopPlantingChecks();
+	GetWorldTimerManager().ClearTimer(ReturnToPoolTimerHandle);
+
+	// Soltarla antes de limpiar el estado: OnReleased no debe intentar plantar otra vez
+	if (GrabComponent)
+	{
+		GrabComponent->SetPooled(true);
 	}
 
+	bIsGrabbed = false;
+	bWasPlanted = false;
+	LastCheckTime = 0.0f;
+}
+
+void ASeedItem::StartPlantingChecks()
+{
+	// Con el presupuesto de frame la búsqueda se reparte entre frames en vez de tickear
+	if (UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this))
+	{
+		SetActorTickEnabled(false);
+		FrameBudget->RegisterRecurring(EFarmWorkSystem::ProximityChecks, this, PlantingCheckInterval,
+			[this](float) { UpdatePlantingCheck(); });
+	}
+}
+
+void ASeedItem::StopPlantingChecks()
+{
+	if (UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this))
+	{
+		FrameBudget->UnregisterRecurring(EFarmWorkSystem::ProximityChecks, this);
+	}
+}
+
+void ASeedItem::ReturnToPool()
+{
+	UFarmActorPoolSubsystem::Release(this);
+}
+
+void ASeedItem::Tick(float DeltaTime)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSeedTick);
+
+	Super::Tick(DeltaTime);
+
 	// Verificar continuamente si está sobre terreno plantable
 	float CurrentTime = GetWorld()->GetTimeSeconds();
-	if (CurrentTime - LastCheckTime < 0.2f) // Cada 0.2 segundos
+	if (CurrentTime - LastCheckTime < PlantingCheckInterval)
 	{
 		return;
 	}
 
 	LastCheckTime = CurrentTime;
 
+	UpdatePlantingCheck();
+}
+
+void ASeedItem::UpdatePlantingCheck()
+{
+	// Solo verificar cuando está siendo soltada o está cerca del suelo
+	if (bWasPlanted)
+	{
+		return; // Ya fue plantada, no hacer nada más
+	}
+
 	// Si está cerca del suelo, verificar
 	if (IsAtPlantingHeight())
 	{
@@ -86,6 +172,20 @@ void ASeedItem::Tick(float DeltaTime)
 	}
 }
 
+// ============================================================
+// SEED SETUP
+// ============================================================
+
+void ASeedItem::InitializeSeed(ECultivoType InCultivoType, TSubclassOf<ACultivo> InCultivoClass)
+{
+	CultivoType = InCultivoType;
+
+	if (InCultivoClass)
+	{
+		CultivoClass = InCultivoClass;
+	}
+}
+
 // ============================================================
 // GRAB EVENTS
 // ============================================================
@@ -111,12 +211,15 @@ void ASeedItem::OnReleased()
 
 void ASeedItem::CheckForPlantableGround()
 {
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSeedParcelaScan);
+
 	if (bWasPlanted)
 	{
 		return;
 	}
 
 	// Buscar parcelas cercanas
+	FARM_COUNTER_INC(ActorScans);
 	TArray<AActor*> FoundParcelas;
 	UGameplayStatics::GetAllActorsOfClass(
 		GetWorld(), 
@@ -124,12 +227,6 @@ void ASeedItem::CheckForPlantableGround()
 		FoundParcelas
 	);
 
-	if (FoundParcelas.Num() == 0)
-	{
-		UE_LOG(LogTemp, Verbose, TEXT("SeedItem: No parcelas found in level"));
-		return;
-	}
-
 	FVector SeedLocation = GetActorLocation();
 
 	// Verificar cada parcela
@@ -145,16 +242,13 @@ void ASeedItem::CheckForPlantableGround()
 		float Distance = FVector::Dist(SeedLocation, Parcela->GetActorLocation());
 
 		// Debug visual
-		FColor DebugColor = FColor::Red;
-		if (Distance < PlantingRadius && Parcela->CanPlant())
-		{
-			DebugColor = FColor::Green;
-		}
+		FARM_DEBUG_DRAW(Seeds, Line, this, SeedLocation, Parcela->GetActorLocation(),
+			Distance < PlantingRadius && Parcela->CanPlant() ? FColor::Green : FColor::Red);
 
 		// Si está lo suficientemente cerca Y la parcela puede plantar
 		if (Distance < PlantingRadius && Parcela->CanPlant())
 		{
-			UE_LOG(LogTemp, Warning, TEXT("SeedItem: Parcela plantable encontrada! Distance: %.2f"), Distance);
+			UE_LOG(LogHarvestHaven, Verbose, TEXT("SeedItem: Parcela plantable encontrada! Distance: %.2f"), Distance);
 			
 			// Intentar plantar
 			if (TryPlantOnParcela(Parcela))
@@ -164,20 +258,68 @@ void ASeedItem::CheckForPlantableGround()
 		}
 	}
 
+	// Campos de parcelas: un actor por campo, la celda sale de la posición
+	FARM_COUNTER_INC(ActorScans);
+	TArray<AActor*> FoundFields;
+	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AParcelaFieldActor::StaticClass(), FoundFields);
+
+	for (AActor* Actor : FoundFields)
+	{
+		if (TryPlantOnField(Cast<AParcelaFieldActor>(Actor)))
+		{
+			return;
+		}
+	}
+
 	UE_LOG(LogTemp, Verbose, TEXT("SeedItem: No plantable parcela nearby"));
 }
 
+bool ASeedItem::TryPlantOnField(AParcelaFieldActor* Field)
+{
+	if (!Field || !CultivoClass || bWasPlanted)
+	{
+		return false;
+	}
+
+	const FVector SeedLocation = GetActorLocation();
+	const int32 Cell = Field->GetCellAt(SeedLocation);
+	if (!Field->CanPlant(Cell) || FVector::Dist(SeedLocation, Field->GetCellLocation(Cell)) >= PlantingRadius)
+	{
+		return false;
+	}
+
+	FARM_TRACE_EVENT_SCOPE(Farm_SeedPlant);
+
+	if (!Field->PlantCrop(Cell, CultivoClass, CultivoType))
+	{
+		FARM_EVENT(SeedPlantFailed, Field, static_cast<float>(CultivoType));
+		return false;
+	}
+
+	bWasPlanted = true;
+
+	FARM_EVENT(SeedPlanted, Field, static_cast<float>(CultivoType));
+	UE_LOG(LogHarvestHaven, Verbose, TEXT("SeedItem: Planted %s on %s cell %d"),
+		*UEnum::GetValueAsString(CultivoType), *Field->GetName(), Cell);
+
+	// Devolver la semilla al pool después de plantarla
+	GetWorldTimerManager().SetTimer(ReturnToPoolTimerHandle, this, &ASeedItem::ReturnToPool, 0.5f, false);
+	return true;
+}
+
 bool ASeedItem::TryPlantOnParcela(AParcelaTierra* Parcela)
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_SeedPlant);
+
 	if (!Parcela || !CultivoClass)
 	{
-		UE_LOG(LogTemp, Error, TEXT("SeedItem: Missing parcela or cultivo class!"));
+		UE_LOG(LogHarvestHaven, Error, TEXT("SeedItem: Missing parcela or cultivo class!"));
 		return false;
 	}
 
 	if (bWasPlanted)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SeedItem: Already planted!"));
+		FARM_EVENT(SeedPlantFailed, Parcela, static_cast<float>(CultivoType));
 		return false;
 	}
 
@@ -203,15 +345,13 @@ bool ASeedItem::TryPlantOnParcela(AParcelaTierra* Parcela)
 	{
 		bWasPlanted = true;
 
-		UE_LOG(LogTemp, Error, TEXT("========================================"));
-		UE_LOG(LogTemp, Error, TEXT("🌱 ¡SEMILLA PLANTADA EXITOSAMENTE!"));
-		UE_LOG(LogTemp, Error, TEXT("Tipo: %s"), *UEnum::GetValueAsString(CultivoType));
-		UE_LOG(LogTemp, Error, TEXT("Parcela: %s"), *Parcela->GetName());
-		UE_LOG(LogTemp, Error, TEXT("========================================"));
-		
+		FARM_EVENT(SeedPlanted, Parcela, static_cast<float>(CultivoType));
+		UE_LOG(LogHarvestHaven, Verbose, TEXT("SeedItem: Planted %s on %s"),
+			*UEnum::GetValueAsString(CultivoType), *Parcela->GetName());
+
 
-		// Destruir la semilla después de plantarla
-		SetLifeSpan(0.5f); // Desaparece después de 0.5s
+		// Devolver la semilla al pool después de plantarla
+		GetWorldTimerManager().SetTimer(ReturnToPoolTimerHandle, this, &ASeedItem::ReturnToPool, 0.5f, false); // Desaparece después de 0.5s
 
 		// Aquí puedes agregar:
 		// - Partículas de plantación
@@ -221,7 +361,7 @@ bool ASeedItem::TryPlantOnParcela(AParcelaTierra* Parcela)
 		return true;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("SeedItem: Failed to plant on parcela"));
+	FARM_EVENT(SeedPlantFailed, Parcela, static_cast<float>(CultivoType));
 	return false;
 }
 
@@ -237,9 +377,9 @@ bool ASeedItem::IsAtPlantingHeight() const
 	FVector End = Start + FVector(0, 0, -500.0f); // 5 metros hacia abajo
 
 	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SeedPlantingHeight), false, this);
 
+	FARM_COUNTER_INC(SceneQueries);
 	bool bHit = GetWorld()->LineTraceSingleByChannel(
 		HitResult,
 		Start,
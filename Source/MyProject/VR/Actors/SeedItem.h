@@ -8,14 +8,16 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "MyProject/VR/Gameplay/GameplayTypes.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
 #include "SeedItem.generated.h"
 
 class UVRGrabComponent;
 class AParcelaTierra;
+class AParcelaFieldActor;
 class ACultivo;
 
 UCLASS()
-class MYPROJECT_API ASeedItem : public AActor
+class MYPROJECT_API ASeedItem : public AActor, public IFarmPoolable
 {
 	GENERATED_BODY()
 
@@ -70,14 +72,41 @@ protected:
 	// Tiempo de última verificación
 	float LastCheckTime;
 
+	// Vuelta al pool tras plantarla
+	FTimerHandle ReturnToPoolTimerHandle;
+
 public:
 	// ============================================================
 	// LIFECYCLE
 	// ============================================================
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
+	// IFarmPoolable
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReturnedToPool() override;
+
+	// ============================================================
+	// SEED SETUP
+	// ============================================================
+
+	// Configurar tipo y clase de cultivo (semillas promovidas desde un montón)
+	UFUNCTION(BlueprintCallable, Category = "Seed")
+	void InitializeSeed(ECultivoType InCultivoType, TSubclassOf<ACultivo> InCultivoClass);
+
+	UFUNCTION(BlueprintPure, Category = "Seed")
+	ECultivoType GetCultivoType() const { return CultivoType; }
+
+	UFUNCTION(BlueprintPure, Category = "Seed")
+	bool IsGrabbed() const { return bIsGrabbed; }
+
+	UFUNCTION(BlueprintPure, Category = "Seed")
+	bool WasPlanted() const { return bWasPlanted; }
+
+	UStaticMeshComponent* GetSeedMesh() const { return SeedMesh; }
+
 private:
 	// ============================================================
 	// GRAB EVENTS
@@ -93,12 +122,24 @@ private:
 	// PLANTING LOGIC
 	// ============================================================
 	
+	// Verificación periódica (desde Tick o desde el presupuesto de frame)
+	void UpdatePlantingCheck();
+
+	// Alta/baja de la verificación en el presupuesto de frame
+	void StartPlantingChecks();
+	void StopPlantingChecks();
+
+	void ReturnToPool();
+
 	// Verificar si hay parcela preparada cerca
 	void CheckForPlantableGround();
 
 	// Intentar plantar en una parcela
 	bool TryPlantOnParcela(AParcelaTierra* Parcela);
 
+	// Intentar plantar en la celda de un campo de parcelas bajo la semilla
+	bool TryPlantOnField(AParcelaFieldActor* Field);
+
 	// Verificar si está a buena altura para plantar
 	bool IsAtPlantingHeight() const;
 };
\ No newline at end of file
@@ -0,0 +1,296 @@
+// ==================================================================
+// SeedPileActor.cpp
+// Implementación del montón de semillas instanciadas
+// ==================================================================
+
+#include "SeedPileActor.h"
+#include "SeedItem.h"
+#include "Cultivo.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmPhysicsSleepSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Seed Pile Checks"), STAT_FarmSeedPileChecks, STATGROUP_HarvestHaven);
+
+ASeedPileActor::ASeedPileActor()
+{
+	// Sin tick: todo va por un timer de baja frecuencia
+	PrimaryActorTick.bCanEverTick = false;
+
+	SeedInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("SeedInstances"));
+	RootComponent = SeedInstances;
+
+	// Sólo consultas: el overlap de agarre (PhysicsBody) devuelve el índice de instancia
+	SeedInstances->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	SeedInstances->SetCollisionObjectType(ECC_PhysicsBody);
+	SeedInstances->SetCollisionResponseToAllChannels(ECR_Ignore);
+	SeedInstances->SetCollisionResponseToChannel(ECC_PhysicsBody, ECR_Overlap);
+	SeedInstances->SetCanEverAffectNavigation(false);
+	SeedInstances->SetCastShadow(false);
+
+	SeedItemClass = ASeedItem::StaticClass();
+
+	Tags.Add(FName("SeedPile"));
+}
+
+void ASeedPileActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (InitialSeedCount > 0)
+	{
+		AddSeeds(InitialSeedType, InitialSeedCount);
+	}
+
+	GetWorldTimerManager().SetTimer(CheckTimerHandle, this, &ASeedPileActor::RunChecks, CheckInterval, true);
+}
+
+void ASeedPileActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorldTimerManager().ClearTimer(CheckTimerHandle);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// ============================================================
+// SEEDS
+// ============================================================
+
+void ASeedPileActor::AddSeeds(ECultivoType Type, int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(Count);
+
+	const int32 FirstSlot = SeedRecords.Num();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Transforms.Add(GetPileSlotTransform(FirstSlot + Index));
+	}
+
+	SeedInstances->AddInstances(Transforms, false, false);
+
+	FSeedProxyRecord Record;
+	Record.CultivoType = Type;
+	SeedRecords.Reserve(SeedRecords.Num() + Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		SeedRecords.Add(Record);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("SeedPile: %s +%d seeds (%d total)"), *GetName(), Count, SeedRecords.Num());
+}
+
+ASeedItem* ASeedPileActor::PromoteInstance(int32 InstanceIndex)
+{
+	FARM_TRACE_EVENT_SCOPE(Farm_SeedPromote);
+
+	if (!SeedRecords.IsValidIndex(InstanceIndex) || !SeedItemClass || !GetWorld())
+	{
+		return nullptr;
+	}
+
+	FTransform InstanceTransform;
+	if (!SeedInstances->GetInstanceTransform(InstanceIndex, InstanceTransform, true))
+	{
+		return nullptr;
+	}
+
+	// El montón queda como owner: así sabe qué semillas siguen siendo suyas
+	FARM_LLM_SCOPE(Grabbables);
+	ASeedItem* Seed = UFarmActorPoolSubsystem::Acquire<ASeedItem>(this, SeedItemClass, InstanceTransform, this);
+	if (!Seed)
+	{
+		return nullptr;
+	}
+
+	Seed->InitializeSeed(SeedRecords[InstanceIndex].CultivoType, CultivoClass);
+
+	// El ISM mantiene el orden de las instancias al borrar, igual que el array de registros
+	SeedInstances->RemoveInstance(InstanceIndex);
+	SeedRecords.RemoveAt(InstanceIndex);
+
+	FPromotedSeed& Promoted = PromotedSeeds.AddDefaulted_GetRef();
+	Promoted.Seed = Seed;
+
+	return Seed;
+}
+
+bool ASeedPileActor::DemoteSeed(ASeedItem* Seed)
+{
+	FARM_TRACE_EVENT_SCOPE(Farm_SeedDemote);
+
+	if (!IsValid(Seed) || Seed->IsGrabbed() || Seed->WasPlanted())
+	{
+		return false;
+	}
+
+	const UStaticMeshComponent* SeedMesh = Seed->GetSeedMesh();
+	const FTransform SeedTransform = SeedMesh ? SeedMesh->GetComponentTransform() : Seed->GetActorTransform();
+
+	SeedInstances->AddInstance(SeedTransform, true);
+
+	FSeedProxyRecord& Record = SeedRecords.AddDefaulted_GetRef();
+	Record.CultivoType = Seed->GetCultivoType();
+
+	PromotedSeeds.RemoveAll([Seed](const FPromotedSeed& Promoted) { return Promoted.Seed.Get() == Seed; });
+	UFarmActorPoolSubsystem::Release(Seed);
+
+	return true;
+}
+
+// ============================================================
+// CHECKS
+// ============================================================
+
+void ASeedPileActor::RunChecks()
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSeedPileChecks);
+
+	if (SeedRecords.Num() > 0)
+	{
+		PromoteNearWakeSources();
+	}
+
+	if (PromotedSeeds.Num() > 0)
+	{
+		DemoteRestingSeeds(CheckInterval);
+	}
+}
+
+void ASeedPileActor::PromoteNearWakeSources()
+{
+	const UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this);
+	if (!SleepSubsystem)
+	{
+		return;
+	}
+
+	const FBoxSphereBounds& PileBounds = SeedInstances->Bounds;
+	int32 Promotions = 0;
+
+	for (const TWeakObjectPtr<USceneComponent>& Source : SleepSubsystem->GetWakeSources())
+	{
+		const USceneComponent* Hand = Source.Get();
+		if (!Hand)
+		{
+			continue;
+		}
+
+		// Descarte barato contra los bounds del montón antes de mirar instancias
+		const FVector HandLocation = Hand->GetComponentLocation();
+		const float Reach = PileBounds.SphereRadius + HoverPromoteRadius;
+		if (FVector::DistSquared(HandLocation, PileBounds.Origin) > Reach * Reach)
+		{
+			continue;
+		}
+
+		TArray<int32> NearInstances = SeedInstances->GetInstancesOverlappingSphere(HandLocation, HoverPromoteRadius, true);
+
+		// De mayor a menor para que los índices restantes sigan siendo válidos
+		NearInstances.Sort(TGreater<int32>());
+
+		for (int32 InstanceIndex : NearInstances)
+		{
+			if (Promotions >= MaxPromotionsPerCheck)
+			{
+				return;
+			}
+
+			if (PromoteInstance(InstanceIndex))
+			{
+				++Promotions;
+			}
+		}
+	}
+}
+
+void ASeedPileActor::DemoteRestingSeeds(float ElapsedTime)
+{
+	const UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this);
+	const float RestSpeedSq = RestSpeed * RestSpeed;
+
+	TArray<ASeedItem*> SeedsToDemote;
+
+	for (int32 Index = PromotedSeeds.Num() - 1; Index >= 0; --Index)
+	{
+		FPromotedSeed& Promoted = PromotedSeeds[Index];
+		ASeedItem* Seed = Promoted.Seed.Get();
+
+		// Plantada, destruida o devuelta al pool: ya no es nuestra
+		if (!IsValid(Seed) || Seed->WasPlanted() || Seed->GetOwner() != this)
+		{
+			PromotedSeeds.RemoveAtSwap(Index);
+			continue;
+		}
+
+		const UStaticMeshComponent* SeedMesh = Seed->GetSeedMesh();
+		if (Seed->IsGrabbed() || !SeedMesh)
+		{
+			Promoted.RestTime = 0.0f;
+			continue;
+		}
+
+		const bool bAtRest = !SeedMesh->IsSimulatingPhysics()
+			|| !SeedMesh->RigidBodyIsAwake()
+			|| SeedMesh->GetPhysicsLinearVelocity().SizeSquared() <= RestSpeedSq;
+
+		Promoted.RestTime = bAtRest ? Promoted.RestTime + ElapsedTime : 0.0f;
+
+		if (Promoted.RestTime < DemoteRestTime)
+		{
+			continue;
+		}
+
+		// Con una mano encima se quedaría promoviendo y degradando en bucle
+		bool bHandNearby = false;
+		if (SleepSubsystem)
+		{
+			for (const TWeakObjectPtr<USceneComponent>& Source : SleepSubsystem->GetWakeSources())
+			{
+				if (Source.IsValid() && FVector::DistSquared(Source->GetComponentLocation(), Seed->GetActorLocation()) <= FMath::Square(HoverPromoteRadius * 2.0f))
+				{
+					bHandNearby = true;
+					break;
+				}
+			}
+		}
+
+		if (!bHandNearby)
+		{
+			SeedsToDemote.Add(Seed);
+		}
+	}
+
+	for (ASeedItem* Seed : SeedsToDemote)
+	{
+		DemoteSeed(Seed);
+	}
+}
+
+FTransform ASeedPileActor::GetPileSlotTransform(int32 SlotIndex) const
+{
+	// Espiral de ángulo áureo por capas: el montón crece hacia arriba al llenarse
+	const float SlotArea = SeedSpacing * SeedSpacing;
+	const int32 SlotsPerLayer = FMath::Max(1, FMath::FloorToInt(PI * PileRadius * PileRadius / SlotArea));
+	const int32 Layer = SlotIndex / SlotsPerLayer;
+	const int32 IndexInLayer = SlotIndex % SlotsPerLayer;
+
+	// Cada capa es algo más estrecha para que parezca un montón
+	const float LayerRadius = PileRadius * FMath::Max(0.3f, 1.0f - Layer * 0.15f);
+	const float Radius = LayerRadius * FMath::Sqrt((IndexInLayer + 0.5f) / SlotsPerLayer);
+	const float Angle = IndexInLayer * 2.39996323f + Layer;
+
+	const FVector Location(Radius * FMath::Cos(Angle), Radius * FMath::Sin(Angle), Layer * SeedSpacing * 0.6f);
+	const FRotator Rotation(0.0f, FMath::RadiansToDegrees(Angle) * 3.0f, 0.0f);
+
+	return FTransform(Rotation, Location);
+}
\ No newline at end of file
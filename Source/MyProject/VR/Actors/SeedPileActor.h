@@ -0,0 +1,152 @@
+// ==================================================================
+// SeedPileActor.h
+// Montón/saco de semillas representado con instancias (un draw call)
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MyProject/VR/Gameplay/GameplayTypes.h"
+#include "SeedPileActor.generated.h"
+
+class UInstancedStaticMeshComponent;
+class ASeedItem;
+class ACultivo;
+
+/**
+ * Registro compacto de una semilla instanciada. La transformación vive en
+ * el ISM; aquí sólo lo necesario para reconstruir el ASeedItem.
+ */
+USTRUCT()
+struct FSeedProxyRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	ECultivoType CultivoType = ECultivoType::Zanahoria;
+};
+
+/**
+ * Montón de semillas sin tick. Cada semilla es una instancia de un ISM
+ * (QueryOnly, tipo PhysicsBody para que el overlap de agarre la encuentre).
+ * Una instancia se promueve a ASeedItem real cuando una mano se acerca o la
+ * agarra, y la semilla vuelve a ser instancia cuando queda en reposo.
+ */
+UCLASS()
+class MYPROJECT_API ASeedPileActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASeedPileActor();
+
+protected:
+	// ============================================================
+	// COMPONENTS
+	// ============================================================
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	UInstancedStaticMeshComponent* SeedInstances;
+
+	// ============================================================
+	// CONFIG
+	// ============================================================
+
+	// Clase de semilla a spawnear al promover una instancia
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config")
+	TSubclassOf<ASeedItem> SeedItemClass;
+
+	// Clase de cultivo que plantarán las semillas promovidas (si está vacía, la del SeedItem)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config")
+	TSubclassOf<ACultivo> CultivoClass;
+
+	// Semillas iniciales al empezar
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config")
+	int32 InitialSeedCount = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config")
+	ECultivoType InitialSeedType = ECultivoType::Zanahoria;
+
+	// Radio del montón y separación entre semillas al apilarlas (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config")
+	float PileRadius = 12.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config")
+	float SeedSpacing = 1.5f;
+
+	// Distancia de la mano a una instancia para promoverla (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config|Promotion")
+	float HoverPromoteRadius = 8.0f;
+
+	// Máximo de instancias promovidas por comprobación de hover
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config|Promotion")
+	int32 MaxPromotionsPerCheck = 3;
+
+	// Frecuencia de comprobación de manos y semillas promovidas (s)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config|Promotion")
+	float CheckInterval = 0.25f;
+
+	// Tiempo en reposo antes de volver a instancia (s)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config|Promotion")
+	float DemoteRestTime = 1.0f;
+
+	// Velocidad por debajo de la cual una semilla se considera en reposo (cm/s)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Seed Pile Config|Promotion")
+	float RestSpeed = 3.0f;
+
+	// ============================================================
+	// STATE
+	// ============================================================
+
+	// Paralelo a las instancias del ISM
+	UPROPERTY()
+	TArray<FSeedProxyRecord> SeedRecords;
+
+	// Semillas promovidas que todavía pueden volver al montón
+	struct FPromotedSeed
+	{
+		TWeakObjectPtr<ASeedItem> Seed;
+		float RestTime = 0.0f;
+	};
+	TArray<FPromotedSeed> PromotedSeeds;
+
+	FTimerHandle CheckTimerHandle;
+
+public:
+	// ============================================================
+	// LIFECYCLE
+	// ============================================================
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// ============================================================
+	// SEEDS
+	// ============================================================
+
+	// Añadir semillas apiladas sobre el montón
+	UFUNCTION(BlueprintCallable, Category = "Seed Pile")
+	void AddSeeds(ECultivoType Type, int32 Count);
+
+	// Convertir una instancia en un ASeedItem real (nullptr si el índice no es válido)
+	UFUNCTION(BlueprintCallable, Category = "Seed Pile")
+	ASeedItem* PromoteInstance(int32 InstanceIndex);
+
+	// Volver a convertir una semilla en instancia
+	UFUNCTION(BlueprintCallable, Category = "Seed Pile")
+	bool DemoteSeed(ASeedItem* Seed);
+
+	UFUNCTION(BlueprintPure, Category = "Seed Pile")
+	int32 GetSeedCount() const { return SeedRecords.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Seed Pile")
+	int32 GetPromotedSeedCount() const { return PromotedSeeds.Num(); }
+
+private:
+	// Comprobación periódica: hover de manos y reposo de semillas promovidas
+	void RunChecks();
+	void PromoteNearWakeSources();
+	void DemoteRestingSeeds(float ElapsedTime);
+	FTransform GetPileSlotTransform(int32 SlotIndex) const;
+};
\ No newline at end of file
@@ -5,14 +5,49 @@
 
 #include "WateringCan.h"
 #include "Cultivo.h"
+#include "ParcelaFieldActor.h"
+#include "ParcelaTierra.h"
 #include "MyProject/VR/Components/VRGrabComponent.h"
+#include "MyProject/VR/Diagnostics/FarmDebugDraw.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmSoilMoistureSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "Particles/ParticleSystemComponent.h"
-#include "DrawDebugHelpers.h"
+#include "Particles/ParticleSystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Watering Can Tick"), STAT_FarmWateringCanTick, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Watering Can Crop Scan"), STAT_FarmWateringCanCropScan, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Watering Can Source Scan"), STAT_FarmWateringCanSourceScan, STATGROUP_HarvestHaven);
+
+// Cultivo que recibe el agua que cae sobre Actor: el propio cultivo, o el de la parcela o celda
+static ACultivo* FindWateredCultivo(AActor* Actor, int32 Item)
+{
+	if (ACultivo* Cultivo = Cast<ACultivo>(Actor))
+	{
+		return Cultivo;
+	}
+
+	if (const AParcelaTierra* Parcela = Cast<AParcelaTierra>(Actor))
+	{
+		return Parcela->GetCurrentCultivo();
+	}
+
+	if (const AParcelaFieldActor* Field = Cast<AParcelaFieldActor>(Actor))
+	{
+		return Field->GetCellCultivo(Item);
+	}
+
+	return nullptr;
+}
 
 AWateringCan::AWateringCan()
 {
+	FARM_LLM_SCOPE(Grabbables);
+
 	PrimaryActorTick.bCanEverTick = true;
 
 	// Cuerpo de la regadera
@@ -37,15 +72,20 @@ AWateringCan::AWateringCan()
 	GrabComponent = CreateDefaultSubobject<UVRGrabComponent>(TEXT("GrabComponent"));
 	GrabComponent->GrabType = EGrabType::Attach;
 
+	// Chorro de agua
+	PourStream = CreateDefaultSubobject<UVRPourStreamComponent>(TEXT("PourStream"));
+
 	// Config por defecto
-	MaxWaterCapacity = 10.0f; // 10 usos
+	MaxWaterCapacity = 10.0f; // 10 segundos de riego a caudal máximo
 	WaterPerUse = 1.0f;
-	WateringRadius = 80.0f;
+	WateringRadius = 25.0f;
+	HumedadPorSegundo = 0.5f;
 	RefillRadius = 150.0f;
 	RefillRate = 2.0f; // 2 unidades por segundo
 	
 	bRequireTilt = true;
 	MinTiltAngle = 45.0f; // Debe inclinarse al menos 45 grados
+	PourTiltRange = 45.0f;
 	
 	WaterSourceTag = FName("WaterSource");
 
@@ -55,6 +95,7 @@ AWateringCan::AWateringCan()
 	bIsWatering = false;
 	bIsRefilling = false;
 	LastCheckTime = 0.0f;
+	LastPourCheckTime = 0.0f;
 	LastWaterTime = 0.0f;
 	LastWateredCrop = nullptr;
 
@@ -79,15 +120,24 @@ void AWateringCan::BeginPlay()
 
 void AWateringCan::Tick(float DeltaTime)
 {
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmWateringCanTick);
+
 	Super::Tick(DeltaTime);
 
+	float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// Regar donde ha caído el agua; la que está en el aire sigue cayendo aunque se suelte
+	if (CurrentTime - LastPourCheckTime > 0.3f)
+	{
+		CheckForCropsToWater();
+		LastPourCheckTime = CurrentTime;
+	}
+
 	if (!bIsGrabbed)
 	{
 		return;
 	}
 
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-
 	// Verificar llenado (cuando está en agua)
 	if (CurrentTime - LastCheckTime > 0.1f)
 	{
@@ -101,14 +151,16 @@ void AWateringCan::Tick(float DeltaTime)
 		RefillWater(DeltaTime);
 	}
 
-	// Verificar si está regando
-	if (!IsEmpty() && IsProperlyTilted())
+	// Verificar si está regando: el caudal sale de la inclinación y del agua que queda
+	const float Flow = GetPourFlow();
+	if (Flow > 0.0f)
 	{
-		// Verificar cada 0.3 segundos para regar
-		if (CurrentTime - LastCheckTime > 0.3f)
+		PourStream->SetEmitter(GetSpoutLocation(), GetSpoutDirection(), Flow);
+		ConsumeWater(FMath::Min(WaterPerUse * Flow * DeltaTime, CurrentWater));
+
+		if (IsEmpty())
 		{
-			CheckForCropsToWater();
-			LastCheckTime = CurrentTime;
+			FARM_EVENT(WateringCanEmpty, this, CurrentWater, MaxWaterCapacity);
 		}
 
 		if (!bIsWatering)
@@ -118,6 +170,8 @@ void AWateringCan::Tick(float DeltaTime)
 	}
 	else
 	{
+		PourStream->StopEmitting();
+
 		if (bIsWatering)
 		{
 			StopWateringEffects();
@@ -140,6 +194,7 @@ void AWateringCan::OnReleased()
 {
 	bIsGrabbed = false;
 	bIsRefilling = false;
+	PourStream->StopEmitting();
 	
 	if (bIsWatering)
 	{
@@ -155,50 +210,51 @@ void AWateringCan::OnReleased()
 
 void AWateringCan::CheckForCropsToWater()
 {
-	if (IsEmpty())
-	{
-		return;
-	}
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmWateringCanCropScan);
 
-	// Buscar cultivos cercanos
-	TArray<AActor*> FoundCultivos;
-	UGameplayStatics::GetAllActorsOfClass(
-		GetWorld(), 
-		ACultivo::StaticClass(), 
-		FoundCultivos
-	);
-
-	if (FoundCultivos.Num() == 0)
+	PourStream->ConsumeImpacts(PourImpacts);
+	if (PourImpacts.Num() == 0)
 	{
 		return;
 	}
 
-	FVector SpoutLocation = WaterSpawnPoint->GetComponentLocation();
-	
+	// Con cuadrícula de humedad el agua moja el suelo donde cae; los cultivos leen su celda
+	UFarmSoilMoistureSubsystem* Suelo = UFarmSoilMoistureSubsystem::Get(this);
+	const bool bRegarSuelo = Suelo && Suelo->IsActive();
+	const float HumedadPorParticula = HumedadPorSegundo / PourStream->GetParticlesPerSecond();
 
-	// Verificar cada cultivo
-	for (AActor* Actor : FoundCultivos)
+	bool bRegadoSuelo = false;
+	for (const FVRPourImpact& Impact : PourImpacts)
 	{
-		ACultivo* Cultivo = Cast<ACultivo>(Actor);
-		if (!Cultivo)
+		if (bRegarSuelo && Suelo->Covers(Impact.Location))
 		{
+			Suelo->AddWater(Impact.Location, WateringRadius, Impact.NumParticles * HumedadPorParticula);
+			bRegadoSuelo = true;
 			continue;
 		}
 
-		float Distance = FVector::Dist(SpoutLocation, Cultivo->GetActorLocation());
-
-		// Si está cerca, regarlo
-		if (Distance < WateringRadius)
+		// Fuera de la cuadrícula (o sin ella): el cultivo sobre el que cae, directamente o a través
+		// de su parcela; esos cultivos siguen con su propio temporizador de riego
+		ACultivo* Cultivo = FindWateredCultivo(Impact.Actor.Get(), Impact.Item);
+		if (Cultivo && !UFarmActorPoolSubsystem::IsPooled(Cultivo))
 		{
 			WaterCrop(Cultivo);
-			return; // Solo regar uno a la vez
 		}
 	}
+
+	// Los cultivos regados directamente ya registran su evento en WaterCrop
+	if (bRegadoSuelo)
+	{
+		FARM_EVENT(WateringCanWatered, this, CurrentWater, MaxWaterCapacity);
+	}
 }
 
 bool AWateringCan::WaterCrop(ACultivo* Crop)
 {
-	if (!Crop || IsEmpty())
+	FARM_TRACE_EVENT_SCOPE(Farm_WaterCrop);
+
+	// El agua ya salió de la regadera al emitir el chorro
+	if (!Crop)
 	{
 		return false;
 	}
@@ -213,14 +269,7 @@ bool AWateringCan::WaterCrop(ACultivo* Crop)
 	// Ya está maduro o seco, no necesita agua
 	if (Crop->IsMature() || Crop->IsDry())
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("WateringCan: Crop doesn't need water (mature/dry)"));
-		return false;
-	}
-
-	// Consumir agua
-	if (!ConsumeWater(WaterPerUse))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("WateringCan: Out of water!"));
+		UE_LOG(LogHarvestHaven, VeryVerbose, TEXT("WateringCan: Crop doesn't need water (mature/dry)"));
 		return false;
 	}
 
@@ -230,19 +279,16 @@ bool AWateringCan::WaterCrop(ACultivo* Crop)
 	LastWateredCrop = Crop;
 	LastWaterTime = CurrentTime;
 
-	UE_LOG(LogTemp, Warning, TEXT("💧 CULTIVO REGADO! Water left: %.1f/%.1f"), 
-		CurrentWater, MaxWaterCapacity);
+	FARM_EVENT(WateringCanWatered, Crop, CurrentWater, MaxWaterCapacity);
 
 	// Efecto visual en el cultivo
-	DrawDebugSphere(
-		GetWorld(),
+	FARM_DEBUG_DRAW(Watering, Sphere,
+		this,
 		Crop->GetActorLocation(),
 		50.0f,
 		16,
 		FColor::Blue,
-		false,
 		2.0f,
-		0,
 		3.0f
 	);
 
@@ -255,6 +301,8 @@ bool AWateringCan::WaterCrop(ACultivo* Crop)
 
 void AWateringCan::CheckForWaterSource()
 {
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmWateringCanSourceScan);
+
 	if (IsFull())
 	{
 		bIsRefilling = false;
@@ -262,6 +310,7 @@ void AWateringCan::CheckForWaterSource()
 	}
 
 	// Buscar actores con tag "WaterSource"
+	FARM_COUNTER_INC(ActorScans);
 	TArray<AActor*> FoundSources;
 	UGameplayStatics::GetAllActorsWithTag(
 		GetWorld(), 
@@ -282,14 +331,12 @@ void AWateringCan::CheckForWaterSource()
 		float Distance = FVector::Dist(CanLocation, Source->GetActorLocation());
 
 		// Debug
-		DrawDebugLine(
-			GetWorld(),
+		FARM_DEBUG_DRAW(Watering, Line,
+			this,
 			CanLocation,
 			Source->GetActorLocation(),
 			Distance < RefillRadius ? FColor::Green : FColor::Yellow,
-			false,
 			0.3f,
-			0,
 			2.0f
 		);
 
@@ -325,15 +372,12 @@ void AWateringCan::RefillWater(float DeltaTime)
 // TILT DETECTION
 // ============================================================
 
-bool AWateringCan::IsProperlyTilted() const
+float AWateringCan::GetTiltAngle() const
 {
-	if (!bRequireTilt)
-	{
-		return true; // No requiere inclinación
-	}
-
-	// Obtener el vector "arriba" de la regadera
-	FVector UpVector = GetActorUpVector();
+	// Obtener el vector "arriba" de la regadera (pose predicha si está en la mano)
+	FVector UpVector = GrabComponent
+		? GrabComponent->GetPredictedComponentTransform(GetRootComponent()).GetRotation().GetUpVector()
+		: GetActorUpVector();
 	
 	// Comparar con el vector arriba del mundo
 	float DotProduct = FVector::DotProduct(UpVector, FVector::UpVector);
@@ -342,20 +386,35 @@ bool AWateringCan::IsProperlyTilted() const
 	float AngleInDegrees = FMath::RadiansToDegrees(FMath::Acos(DotProduct));
 
 	// Debug visual
-	FVector CanLocation = GetActorLocation();
-	DrawDebugDirectionalArrow(
-		GetWorld(),
-		CanLocation,
-		CanLocation + (UpVector * 50.0f),
+	FARM_DEBUG_DRAW(Watering, Arrow,
+		this,
+		GetActorLocation(),
+		GetActorLocation() + (UpVector * 50.0f),
 		20.0f,
 		AngleInDegrees > MinTiltAngle ? FColor::Green : FColor::Red,
-		false,
 		0.1f,
-		0,
 		3.0f
 	);
 
-	return AngleInDegrees > MinTiltAngle;
+	return AngleInDegrees;
+}
+
+float AWateringCan::GetPourFlow() const
+{
+	if (IsEmpty())
+	{
+		return 0.0f;
+	}
+
+	if (!bRequireTilt)
+	{
+		return 1.0f; // No requiere inclinación
+	}
+
+	// Con menos agua dentro hay que inclinarla más para que salga
+	const float TiltRange = FMath::Max(PourTiltRange, 1.0f);
+	const float Threshold = MinTiltAngle + (1.0f - GetWaterPercentage()) * TiltRange;
+	return FMath::Clamp((GetTiltAngle() - Threshold) / TiltRange, 0.0f, 1.0f);
 }
 
 // ============================================================
@@ -393,6 +452,26 @@ bool AWateringCan::IsEmpty() const
 	return CurrentWater <= 0.0f;
 }
 
+FVector AWateringCan::GetSpoutLocation() const
+{
+	if (GrabComponent)
+	{
+		return GrabComponent->GetPredictedComponentTransform(WaterSpawnPoint).GetLocation();
+	}
+
+	return WaterSpawnPoint->GetComponentLocation();
+}
+
+FVector AWateringCan::GetSpoutDirection() const
+{
+	if (GrabComponent)
+	{
+		return GrabComponent->GetPredictedComponentTransform(WaterSpawnPoint).GetRotation().GetForwardVector();
+	}
+
+	return WaterSpawnPoint->GetForwardVector();
+}
+
 // ============================================================
 // EFFECTS
 // ============================================================
@@ -401,28 +480,19 @@ void AWateringCan::StartWateringEffects()
 {
 	bIsWatering = true;
 
-	// Spawn partículas de agua
-	if (WaterParticles && WaterSpawnPoint)
+	if (UFarmFXSubsystem* FX = UFarmFXSubsystem::Get(this))
 	{
-		UGameplayStatics::SpawnEmitterAttached(
-			WaterParticles,
-			WaterSpawnPoint,
-			NAME_None,
-			FVector::ZeroVector,
-			FRotator::ZeroRotator,
-			EAttachLocation::KeepRelativeOffset,
-			true
-		);
-	}
+		// Partículas de agua en el pico y sonido, con clave: reanudan los de esta regadera
+		FFarmFXParams Params;
+		Params.Category = EFarmFXCategory::Watering;
+		Params.AttachTo = WaterSpawnPoint;
+		Params.Owner = this;
 
-	// Reproducir sonido
-	if (WateringSound)
-	{
-		UGameplayStatics::PlaySoundAtLocation(
-			this,
-			WateringSound,
-			GetActorLocation()
-		);
+		Params.Key = FName("Pour");
+		WaterEffectHandle = FX->PlayFX(WaterParticles, Params);
+
+		Params.Key = FName("PourSound");
+		WateringSoundHandle = FX->PlaySound(WateringSound, Params);
 	}
 
 	UE_LOG(LogTemp, Verbose, TEXT("WateringCan: Started watering"));
@@ -431,30 +501,37 @@ void AWateringCan::StartWateringEffects()
 void AWateringCan::StopWateringEffects()
 {
 	bIsWatering = false;
+
+	// Deja de emitir; las partículas ya emitidas terminan solas
+	if (UFarmFXSubsystem* FX = UFarmFXSubsystem::Get(this))
+	{
+		FX->Stop(WaterEffectHandle);
+		FX->Stop(WateringSoundHandle);
+	}
+
 	UE_LOG(LogTemp, Verbose, TEXT("WateringCan: Stopped watering"));
 }
 
 void AWateringCan::PlayRefillEffects()
 {
-	if (RefillSound)
+	if (UFarmFXSubsystem* FX = UFarmFXSubsystem::Get(this))
 	{
-		UGameplayStatics::PlaySoundAtLocation(
-			this,
-			RefillSound,
-			GetActorLocation()
-		);
+		FFarmFXParams Params;
+		Params.Category = EFarmFXCategory::Refill;
+		Params.Location = GetActorLocation();
+		Params.Owner = this;
+		Params.Key = FName("Refill");
+		FX->PlaySound(RefillSound, Params);
 	}
 
 	// Efecto visual de llenado
-	DrawDebugSphere(
-		GetWorld(),
+	FARM_DEBUG_DRAW(Watering, Sphere,
+		this,
 		GetActorLocation(),
 		RefillRadius,
 		16,
 		FColor::Cyan,
-		false,
 		1.0f,
-		0,
 		2.0f
 	);
 }
\ No newline at end of file
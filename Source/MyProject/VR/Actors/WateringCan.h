@@ -7,6 +7,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "MyProject/VR/Components/VRPourStreamComponent.h"
+#include "MyProject/VR/Subsystems/FarmFXSubsystem.h"
 #include "WateringCan.generated.h"
 
 class UVRGrabComponent;
@@ -41,6 +43,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UVRGrabComponent* GrabComponent;
 
+	// Chorro de agua simulado: decide qué se riega según dónde cae el agua
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	UVRPourStreamComponent* PourStream;
+
 	// ============================================================
 	// CONFIG - WATER SYSTEM
 	// ============================================================
@@ -49,14 +55,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
 	float MaxWaterCapacity;
 
-	// Agua consumida por cada uso
+	// Agua que sale por segundo con caudal máximo
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
 	float WaterPerUse;
 
-	// Radio de detección de cultivos (cm)
+	// Radio de salpicadura alrededor de donde cae el agua, al mojar el suelo (cm)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
 	float WateringRadius;
 
+	// Humedad que deja en el suelo un segundo de chorro a caudal máximo (con UFarmSoilMoistureSubsystem)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
+	float HumedadPorSegundo;
+
 	// ¿Necesita estar inclinada para regar? (más realista)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
 	bool bRequireTilt;
@@ -65,6 +75,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
 	float MinTiltAngle;
 
+	// Grados extra para pasar de un hilo a caudal máximo; vacía, el umbral sube lo mismo
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watering Config")
+	float PourTiltRange;
+
 	// ============================================================
 	// CONFIG - REFILL SYSTEM
 	// ============================================================
@@ -120,10 +134,20 @@ protected:
 	// Tiempo de última verificación
 	float LastCheckTime;
 
+	// Tiempo de la última recogida de impactos del chorro
+	float LastPourCheckTime;
+
+	// Impactos recogidos del chorro (se reutiliza la memoria)
+	TArray<FVRPourImpact> PourImpacts;
+
 	// Último cultivo regado (cooldown)
 	UPROPERTY()
 	ACultivo* LastWateredCrop;
 
+	// Efectos del riego en UFarmFXSubsystem, con clave propia: inclinar y enderezar reutiliza los mismos
+	FFarmFXHandle WaterEffectHandle;
+	FFarmFXHandle WateringSoundHandle;
+
 	float LastWaterTime;
 
 public:
@@ -154,6 +178,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Watering")
 	bool IsEmpty() const;
 
+	// Posición del pico con la pose predicha de la mano (la misma con la que se renderiza)
+	UFUNCTION(BlueprintPure, Category = "Watering")
+	FVector GetSpoutLocation() const;
+
+	// Dirección de salida del agua, con la misma pose predicha
+	UFUNCTION(BlueprintPure, Category = "Watering")
+	FVector GetSpoutDirection() const;
+
+	// Caudal (0-1) según la inclinación y el agua que queda
+	UFUNCTION(BlueprintPure, Category = "Watering")
+	float GetPourFlow() const;
+
 private:
 	// ============================================================
 	// INTERNAL FUNCTIONS
@@ -165,10 +201,10 @@ private:
 	UFUNCTION()
 	void OnReleased();
 
-	// Verificar si está inclinada correctamente
-	bool IsProperlyTilted() const;
+	// Inclinación respecto a la vertical (grados)
+	float GetTiltAngle() const;
 
-	// Buscar cultivos cercanos para regar
+	// Regar lo que hay donde ha caído el agua del chorro
 	void CheckForCropsToWater();
 
 	// Regar un cultivo específico
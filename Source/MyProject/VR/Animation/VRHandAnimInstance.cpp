@@ -0,0 +1,67 @@
+#include "VRHandAnimInstance.h"
+
+void FVRHandAnimInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds)
+{
+	FAnimInstanceProxy::PreUpdate(InAnimInstance, DeltaSeconds);
+
+	// Runs on the game thread before the (possibly parallel) graph update
+	if (const UVRHandAnimInstance* HandInstance = Cast<UVRHandAnimInstance>(InAnimInstance))
+	{
+		PoseAlphas[static_cast<int32>(EVRHandPoseChannel::ThumbUp)] = HandInstance->PoseAlphaThumbUp;
+		PoseAlphas[static_cast<int32>(EVRHandPoseChannel::Point)] = HandInstance->PoseAlphaPoint;
+		PoseAlphas[static_cast<int32>(EVRHandPoseChannel::IndexCurl)] = HandInstance->PoseAlphaIndexCurl;
+		PoseAlphas[static_cast<int32>(EVRHandPoseChannel::Grasp)] = HandInstance->PoseAlphaGrasp;
+		bMirror = HandInstance->bMirror;
+	}
+}
+
+void UVRHandAnimInstance::SetPoseAlpha(EVRHandPoseChannel Channel, float Alpha)
+{
+	switch (Channel)
+	{
+	case EVRHandPoseChannel::ThumbUp:
+		PoseAlphaThumbUp = Alpha;
+		break;
+
+	case EVRHandPoseChannel::Point:
+		PoseAlphaPoint = Alpha;
+		break;
+
+	case EVRHandPoseChannel::IndexCurl:
+		PoseAlphaIndexCurl = Alpha;
+		break;
+
+	case EVRHandPoseChannel::Grasp:
+		PoseAlphaGrasp = Alpha;
+		break;
+
+	default:
+		break;
+	}
+}
+
+float UVRHandAnimInstance::GetPoseAlpha(EVRHandPoseChannel Channel) const
+{
+	const int32 Index = static_cast<int32>(Channel);
+	if (Index < 0 || Index >= static_cast<int32>(EVRHandPoseChannel::Count))
+	{
+		return 0.0f;
+	}
+
+	return GetProxyOnAnyThread<FVRHandAnimInstanceProxy>().PoseAlphas[Index];
+}
+
+bool UVRHandAnimInstance::IsMirrored() const
+{
+	return GetProxyOnAnyThread<FVRHandAnimInstanceProxy>().bMirror;
+}
+
+FAnimInstanceProxy* UVRHandAnimInstance::CreateAnimInstanceProxy()
+{
+	return new FVRHandAnimInstanceProxy(this);
+}
+
+void UVRHandAnimInstance::DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy)
+{
+	delete InProxy;
+}
\ No newline at end of file
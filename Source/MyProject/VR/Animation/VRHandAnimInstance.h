@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "VRHandAnimInstance.generated.h"
+
+UENUM(BlueprintType)
+enum class EVRHandPoseChannel : uint8
+{
+	ThumbUp,
+	Point,
+	IndexCurl,
+	Grasp,
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EVRHandPoseChannel, EVRHandPoseChannel::Count);
+
+/**
+ * Game-thread values copied once per update so the anim graph can read them on a worker thread.
+ */
+USTRUCT()
+struct MYPROJECT_API FVRHandAnimInstanceProxy : public FAnimInstanceProxy
+{
+	GENERATED_BODY()
+
+	FVRHandAnimInstanceProxy() = default;
+	FVRHandAnimInstanceProxy(UAnimInstance* Instance) : FAnimInstanceProxy(Instance) {}
+
+	float PoseAlphas[static_cast<int32>(EVRHandPoseChannel::Count)] = {};
+	bool bMirror = false;
+
+protected:
+	virtual void PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds) override;
+};
+
+/**
+ * Native parent class for the hand AnimBP.
+ *
+ * UVRHandAnimationComponent writes the pose alphas as plain stores; the graph reads them through
+ * the thread-safe getters, so the AnimBP can enable bUseMultiThreadedAnimationUpdate.
+ * When reparenting an existing hand AnimBP, remove its PoseAlpha and bMirror variables.
+ */
+UCLASS(Transient, Blueprintable)
+class MYPROJECT_API UVRHandAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+	friend struct FVRHandAnimInstanceProxy;
+
+public:
+	// Game thread
+	void SetPoseAlpha(EVRHandPoseChannel Channel, float Alpha);
+	void SetMirror(bool bInMirror) { bMirror = bInMirror; }
+
+	// Anim graph (any thread)
+	UFUNCTION(BlueprintPure, Category = "VR Hand Pose", meta = (BlueprintThreadSafe))
+	float GetPoseAlpha(EVRHandPoseChannel Channel) const;
+
+	UFUNCTION(BlueprintPure, Category = "VR Hand Pose", meta = (BlueprintThreadSafe))
+	float GetThumbUpAlpha() const { return GetPoseAlpha(EVRHandPoseChannel::ThumbUp); }
+
+	UFUNCTION(BlueprintPure, Category = "VR Hand Pose", meta = (BlueprintThreadSafe))
+	float GetPointAlpha() const { return GetPoseAlpha(EVRHandPoseChannel::Point); }
+
+	UFUNCTION(BlueprintPure, Category = "VR Hand Pose", meta = (BlueprintThreadSafe))
+	float GetIndexCurlAlpha() const { return GetPoseAlpha(EVRHandPoseChannel::IndexCurl); }
+
+	UFUNCTION(BlueprintPure, Category = "VR Hand Pose", meta = (BlueprintThreadSafe))
+	float GetGraspAlpha() const { return GetPoseAlpha(EVRHandPoseChannel::Grasp); }
+
+	UFUNCTION(BlueprintPure, Category = "VR Hand Pose", meta = (BlueprintThreadSafe))
+	bool IsMirrored() const;
+
+protected:
+	// Game-thread values, written by UVRHandAnimationComponent
+	UPROPERTY(VisibleInstanceOnly, Category = "VR Hand Pose")
+	float PoseAlphaThumbUp = 0.0f;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "VR Hand Pose")
+	float PoseAlphaPoint = 0.0f;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "VR Hand Pose")
+	float PoseAlphaIndexCurl = 0.0f;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "VR Hand Pose")
+	float PoseAlphaGrasp = 0.0f;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "VR Hand Pose")
+	bool bMirror = false;
+
+	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
+	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy) override;
+};
\ No newline at end of file
@@ -0,0 +1,140 @@
+// ==================================================================
+// FarmHeadlessWorld.cpp
+// ==================================================================
+
+#include "FarmHeadlessWorld.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameModeBase.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+FFarmHeadlessWorld::~FFarmHeadlessWorld()
+{
+	Destroy();
+}
+
+bool FFarmHeadlessWorld::Create(const FString& MapPath, TSubclassOf<AGameModeBase> GameModeClass)
+{
+	Destroy();
+
+	if (MapPath.IsEmpty())
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, true, TEXT("FarmHeadlessWorld"));
+	}
+	else
+	{
+		UPackage* Package = LoadPackage(nullptr, *MapPath, LOAD_None);
+		World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+
+		if (!World)
+		{
+			UE_LOG(LogTemp, Error, TEXT("FarmHeadlessWorld: Cannot load map %s"), *MapPath);
+			return false;
+		}
+
+		World->WorldType = EWorldType::Game;
+	}
+
+	if (!World)
+	{
+		return false;
+	}
+
+	World->AddToRoot();
+
+	// SetGameMode asks the world's game instance for the game mode, so both paths need one,
+	// registered in a world context of our own (Destroy tears that context down)
+	GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->AddToRoot();
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.OwningGameInstance = GameInstance;
+	WorldContext.SetCurrentWorld(World);
+	World->SetGameInstance(GameInstance);
+
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.AllowAudioPlayback(false)
+			.CreatePhysicsScene(true)
+			.ShouldSimulatePhysics(true)
+			.CreateAISystem(false)
+			.CreateNavigation(false));
+	}
+
+	if (!MapPath.IsEmpty())
+	{
+		World->UpdateWorldComponents(true, false);
+	}
+
+	// Without a game mode no actor receives BeginPlay
+	FURL URL;
+	if (GameModeClass)
+	{
+		URL.AddOption(*FString::Printf(TEXT("game=%s"), *GameModeClass->GetPathName()));
+	}
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	return true;
+}
+
+void FFarmHeadlessWorld::Tick(float DeltaTime)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	World->Tick(LEVELTICK_All, DeltaTime);
+	++GFrameCounter;
+}
+
+void FFarmHeadlessWorld::Destroy()
+{
+	if (!World)
+	{
+		return;
+	}
+
+	World->BeginTearingDown();
+	World->DestroyWorld(false);
+	GEngine->DestroyWorldContext(World);
+	World->RemoveFromRoot();
+	World = nullptr;
+
+	if (GameInstance)
+	{
+		GameInstance->RemoveFromRoot();
+		GameInstance = nullptr;
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void FFarmHeadlessWorld::CountObjects(int32& OutActors, int32& OutComponents, int32& OutTickingActors) const
+{
+	OutActors = 0;
+	OutComponents = 0;
+	OutTickingActors = 0;
+
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		++OutActors;
+		OutComponents += It->GetComponents().Num();
+
+		if (It->PrimaryActorTick.IsTickFunctionEnabled())
+		{
+			++OutTickingActors;
+		}
+	}
+}
\ No newline at end of file
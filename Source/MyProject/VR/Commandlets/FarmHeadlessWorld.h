@@ -0,0 +1,37 @@
+// ==================================================================
+// FarmHeadlessWorld.h
+// Game world driven by hand from a commandlet (no viewport, no HMD)
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+
+class AGameModeBase;
+class UGameInstance;
+class UWorld;
+
+/**
+ * Owns a game world for headless tools: loads a map (or creates an empty
+ * world), begins play, ticks it with a fixed delta time and tears it down.
+ */
+class MYPROJECT_API FFarmHeadlessWorld
+{
+public:
+	~FFarmHeadlessWorld();
+
+	// Empty MapPath creates an empty world; GameModeClass overrides the map's/project's game mode
+	bool Create(const FString& MapPath, TSubclassOf<AGameModeBase> GameModeClass = nullptr);
+	void Tick(float DeltaTime);
+	void Destroy();
+
+	UWorld* GetWorld() const { return World; }
+
+	// Actors, components and ticking actors currently in the world
+	void CountObjects(int32& OutActors, int32& OutComponents, int32& OutTickingActors) const;
+
+private:
+	UWorld* World = nullptr;
+	UGameInstance* GameInstance = nullptr;
+};
\ No newline at end of file
@@ -0,0 +1,520 @@
+// ==================================================================
+// FarmStressCommandlet.cpp
+// ==================================================================
+
+#include "FarmStressCommandlet.h"
+#include "FarmHeadlessWorld.h"
+#include "MyProject/VR/Actors/ParcelaTierra.h"
+#include "MyProject/VR/Actors/Cultivo.h"
+#include "MyProject/VR/Diagnostics/FarmAllocCounter.h"
+#include "MyProject/VR/Subsystems/FarmMemoryBudgetSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmSpawnQueueSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectArray.h"
+
+namespace FarmStress
+{
+	constexpr int32 NumCultivoTypes = 5;
+	constexpr int32 WarmupFrames = 10;
+
+	double GetUsedMemoryMB()
+	{
+		return static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0);
+	}
+
+	int32 GetUObjectCount()
+	{
+		return GUObjectArray.GetObjectArrayNumMinusAvailable();
+	}
+
+	float Percentile(const TArray<float>& Sorted, float Fraction)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0.0f;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+}
+
+UFarmStressCommandlet::UFarmStressCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UFarmStressCommandlet::Main(const FString& Params)
+{
+	FRunSettings Settings;
+	FParse::Value(*Params, TEXT("Map="), Settings.MapPath);
+	FParse::Value(*Params, TEXT("Frames="), Settings.Frames);
+	FParse::Value(*Params, TEXT("CycleFrames="), Settings.CycleFrames);
+	FParse::Value(*Params, TEXT("DeltaTime="), Settings.DeltaTime);
+	FParse::Value(*Params, TEXT("GrowthTime="), Settings.GrowthTime);
+	FParse::Value(*Params, TEXT("Spacing="), Settings.Spacing);
+	Settings.bSpawnQueue = FParse::Param(*Params, TEXT("SpawnQueue"));
+
+	Settings.Frames = FMath::Max(1, Settings.Frames);
+	Settings.CycleFrames = FMath::Max(1, Settings.CycleFrames);
+	Settings.DeltaTime = FMath::Max(KINDA_SMALL_NUMBER, Settings.DeltaTime);
+
+	FString CountsString = TEXT("100,1000,10000,50000");
+	FParse::Value(*Params, TEXT("Counts="), CountsString, false);
+
+	TArray<FString> CountTokens;
+	CountsString.ParseIntoArray(CountTokens, TEXT(","));
+
+	TArray<int32> Counts;
+	for (const FString& Token : CountTokens)
+	{
+		const int32 Count = FCString::Atoi(*Token);
+		if (Count > 0)
+		{
+			Counts.Add(Count);
+		}
+	}
+
+	if (Counts.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FarmStress: No valid parcel counts in -Counts=%s"), *CountsString);
+		return 1;
+	}
+
+	FString ReportName = FString::Printf(TEXT("FarmStress_%s"), *FDateTime::Now().ToString());
+	FParse::Value(*Params, TEXT("Report="), ReportName);
+
+	// Farm actors log every state change; at 50k parcels that is the benchmark
+	const ELogVerbosity::Type PreviousVerbosity = LogTemp.GetVerbosity();
+
+	TArray<FRunResult> Results;
+	for (const int32 Count : Counts)
+	{
+		UE_LOG(LogTemp, Display, TEXT("FarmStress: Running %d parcels for %d frames"), Count, Settings.Frames);
+
+		LogTemp.SetVerbosity(ELogVerbosity::Warning);
+
+		FRunResult Result;
+		const bool bSucceeded = RunCount(Count, Settings, Result);
+
+		LogTemp.SetVerbosity(PreviousVerbosity);
+
+		if (!bSucceeded)
+		{
+			return 1;
+		}
+
+		UE_LOG(LogTemp, Display,
+			TEXT("FarmStress: N=%d  frame avg %.2f ms  p95 %.2f ms  p99 %.2f ms  max %.2f ms  actors %d  components %d  mem peak %.0f MB  allocs/frame %.0f  frees/frame %.0f"),
+			Result.ParcelCount, Result.FrameMsAvg, Result.FrameMsP95, Result.FrameMsP99, Result.FrameMsMax,
+			Result.Actors, Result.Components, Result.MemUsedPeakMB, Result.AllocsPerFrame, Result.FreesPerFrame);
+
+		for (const FString& System : Result.OverBudgetSystems)
+		{
+			UE_LOG(LogTemp, Error, TEXT("FarmStress: N=%d  %s"), Result.ParcelCount, *System);
+		}
+
+		Results.Add(Result);
+	}
+
+	const FString ReportDir = FPaths::ProjectSavedDir() / TEXT("FarmStress");
+	const FString CsvPath = ReportDir / (ReportName + TEXT(".csv"));
+	const FString JsonPath = ReportDir / (ReportName + TEXT(".json"));
+
+	if (!WriteCsv(CsvPath, Results) || !WriteJson(JsonPath, Settings, Results))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FarmStress: Cannot write report to %s"), *ReportDir);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("FarmStress: Report written to %s and %s"), *CsvPath, *JsonPath);
+
+	if (!FFarmMemory::IsTrackingEnabled())
+	{
+		UE_LOG(LogTemp, Display, TEXT("FarmStress: Memory budgets not checked, run with -llm"));
+		return 0;
+	}
+
+	const bool bOverBudget = Results.ContainsByPredicate([](const FRunResult& Result) { return Result.OverBudgetSystems.Num() > 0; });
+	if (bOverBudget)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FarmStress: Farm memory budget exceeded"));
+		return 1;
+	}
+
+	return 0;
+}
+
+bool UFarmStressCommandlet::RunCount(int32 ParcelCount, const FRunSettings& Settings, FRunResult& OutResult)
+{
+	OutResult = FRunResult();
+	OutResult.ParcelCount = ParcelCount;
+	OutResult.Frames = Settings.Frames;
+	OutResult.MemUsedBeforeMB = FarmStress::GetUsedMemoryMB();
+	OutResult.UObjectsBefore = FarmStress::GetUObjectCount();
+
+	FFarmHeadlessWorld HeadlessWorld;
+	if (!HeadlessWorld.Create(Settings.MapPath))
+	{
+		return false;
+	}
+
+	const double SpawnStart = FPlatformTime::Seconds();
+	SpawnParcels(HeadlessWorld, ParcelCount, Settings, OutResult);
+	OutResult.SpawnMs = (FPlatformTime::Seconds() - SpawnStart) * 1000.0;
+
+	if (Parcels.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FarmStress: No parcels spawned for N=%d"), ParcelCount);
+		HeadlessWorld.Destroy();
+		return false;
+	}
+
+	for (int32 Frame = 0; Frame < FarmStress::WarmupFrames; ++Frame)
+	{
+		HeadlessWorld.Tick(Settings.DeltaTime);
+	}
+
+	// Every parcel is visited once per CycleFrames, spread evenly across frames
+	const int32 ParcelsPerFrame = FMath::DivideAndRoundUp(ParcelCount, Settings.CycleFrames);
+	int32 Cursor = 0;
+
+	TArray<float> FrameTimes;
+	FrameTimes.Reserve(Settings.Frames);
+	double WorldTickMsTotal = 0.0;
+	OutResult.MemUsedPeakMB = FarmStress::GetUsedMemoryMB();
+
+	TOptional<FFarmAllocCounter> AllocCounter;
+	AllocCounter.Emplace();
+
+	for (int32 Frame = 0; Frame < Settings.Frames; ++Frame)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+
+		for (int32 Step = 0; Step < ParcelsPerFrame; ++Step)
+		{
+			StepParcel(Cursor, Settings, OutResult);
+			Cursor = (Cursor + 1) % Parcels.Num();
+		}
+
+		const double TickStart = FPlatformTime::Seconds();
+		HeadlessWorld.Tick(Settings.DeltaTime);
+		const double FrameEnd = FPlatformTime::Seconds();
+
+		WorldTickMsTotal += (FrameEnd - TickStart) * 1000.0;
+		FrameTimes.Add(static_cast<float>((FrameEnd - FrameStart) * 1000.0));
+		OutResult.MemUsedPeakMB = FMath::Max(OutResult.MemUsedPeakMB, FarmStress::GetUsedMemoryMB());
+
+		// Once per cycle: every parcel has been through a step since the last sample
+		if ((Frame + 1) % Settings.CycleFrames == 0 || Frame + 1 == Settings.Frames)
+		{
+			SampleMemoryBudgets(HeadlessWorld.GetWorld(), OutResult);
+		}
+	}
+
+	OutResult.Allocations = AllocCounter->GetAllocations();
+	OutResult.Frees = AllocCounter->GetFrees();
+	OutResult.AllocsPerFrame = static_cast<double>(OutResult.Allocations) / Settings.Frames;
+	OutResult.FreesPerFrame = static_cast<double>(OutResult.Frees) / Settings.Frames;
+	AllocCounter.Reset();
+
+	HeadlessWorld.CountObjects(OutResult.Actors, OutResult.Components, OutResult.TickingActors);
+
+	double FrameMsTotal = 0.0;
+	for (const float FrameMs : FrameTimes)
+	{
+		FrameMsTotal += FrameMs;
+	}
+
+	FrameTimes.Sort();
+	OutResult.FrameMsAvg = static_cast<float>(FrameMsTotal / FrameTimes.Num());
+	OutResult.FrameMsP50 = FarmStress::Percentile(FrameTimes, 0.50f);
+	OutResult.FrameMsP95 = FarmStress::Percentile(FrameTimes, 0.95f);
+	OutResult.FrameMsP99 = FarmStress::Percentile(FrameTimes, 0.99f);
+	OutResult.FrameMsMax = FrameTimes.Last();
+	OutResult.WorldTickMsAvg = static_cast<float>(WorldTickMsTotal / FrameTimes.Num());
+
+	Parcels.Reset();
+	HeadlessWorld.Destroy();
+
+	OutResult.MemUsedAfterMB = FarmStress::GetUsedMemoryMB();
+	OutResult.UObjectsAfter = FarmStress::GetUObjectCount();
+
+	return true;
+}
+
+void UFarmStressCommandlet::SampleMemoryBudgets(const UWorld* World, FRunResult& Result)
+{
+	const UFarmMemoryBudgetSubsystem* MemoryBudget = UFarmMemoryBudgetSubsystem::Get(World);
+	if (!MemoryBudget || !FFarmMemory::IsTrackingEnabled())
+	{
+		return;
+	}
+
+	TArray<FFarmMemoryBudgetStatus> Table;
+	MemoryBudget->GetBudgetStatus(Table);
+	++Result.BudgetSamples;
+
+	for (int32 Index = 0; Index < Table.Num(); ++Index)
+	{
+		const FFarmMemoryBudgetStatus& Status = Table[Index];
+		Result.FarmMemoryPeakMB[Index] = FMath::Max(Result.FarmMemoryPeakMB[Index], Status.UsedMB);
+		Result.FarmMemoryBudgetMB[Index] = Status.BudgetMB;
+
+		if (Status.bOverBudget)
+		{
+			Result.OverBudgetSystems.AddUnique(FString::Printf(TEXT("%s over budget (%.2f MB of %.2f MB)"),
+				Status.SystemName, Status.UsedMB, Status.BudgetMB));
+		}
+	}
+}
+
+void UFarmStressCommandlet::SpawnParcels(FFarmHeadlessWorld& HeadlessWorld, int32 ParcelCount, const FRunSettings& Settings, FRunResult& Result)
+{
+	UWorld* World = HeadlessWorld.GetWorld();
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(ParcelCount)));
+
+	UFarmSpawnQueueSubsystem* SpawnQueue = Settings.bSpawnQueue ? UFarmSpawnQueueSubsystem::Get(World) : nullptr;
+	if (SpawnQueue)
+	{
+		TArray<FFarmSpawnRequest> Requests;
+		Requests.Reserve(ParcelCount);
+		for (int32 Index = 0; Index < ParcelCount; ++Index)
+		{
+			FFarmSpawnRequest& Request = Requests.AddDefaulted_GetRef();
+			Request.Class = AParcelaTierra::StaticClass();
+			Request.MemorySystem = EFarmMemorySystem::Parcels;
+			Request.Transform.SetLocation(FVector((Index % GridSize) * Settings.Spacing, (Index / GridSize) * Settings.Spacing, 0.0f));
+			Request.OnSpawned = [this](AActor* Actor) { Parcels.Add(CastChecked<AParcelaTierra>(Actor)); };
+		}
+
+		Parcels.Reset(ParcelCount);
+		const int32 BatchId = SpawnQueue->SubmitBatch(MoveTemp(Requests));
+
+		// The queue only advances with the world; a budget too small to spawn one parcel per frame still
+		// gets one through the frame-budget starvation rule, so this ends
+		while (SpawnQueue->IsBatchPending(BatchId))
+		{
+			const double FrameStart = FPlatformTime::Seconds();
+			HeadlessWorld.Tick(Settings.DeltaTime);
+
+			Result.SpawnFrameMsMax = FMath::Max(Result.SpawnFrameMsMax, static_cast<float>((FPlatformTime::Seconds() - FrameStart) * 1000.0));
+			++Result.SpawnFrames;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("FarmStress: %d parcels spawned over %d frames, worst frame %.2f ms"),
+			Parcels.Num(), Result.SpawnFrames, Result.SpawnFrameMsMax);
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	Parcels.Reset(ParcelCount);
+	for (int32 Index = 0; Index < ParcelCount; ++Index)
+	{
+		const FVector Location(
+			(Index % GridSize) * Settings.Spacing,
+			(Index / GridSize) * Settings.Spacing,
+			0.0f);
+
+		FARM_LLM_SCOPE(Parcels);
+		if (AParcelaTierra* Parcela = World->SpawnActor<AParcelaTierra>(AParcelaTierra::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams))
+		{
+			Parcels.Add(Parcela);
+		}
+	}
+}
+
+void UFarmStressCommandlet::StepParcel(int32 ParcelIndex, const FRunSettings& Settings, FRunResult& Result)
+{
+	AParcelaTierra* Parcela = Parcels.IsValidIndex(ParcelIndex) ? Parcels[ParcelIndex] : nullptr;
+	if (!Parcela)
+	{
+		return;
+	}
+
+	const double Start = FPlatformTime::Seconds();
+
+	switch (Parcela->GetCurrentState())
+	{
+	case EParcelaState::SinPreparar:
+	{
+		Parcela->PrepareGround();
+		Result.PrepareMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+		++Result.PrepareCalls;
+		break;
+	}
+
+	case EParcelaState::Preparada:
+	{
+		const ECultivoType Type = static_cast<ECultivoType>(ParcelIndex % FarmStress::NumCultivoTypes);
+		if (Parcela->PlantCrop(ACultivo::StaticClass(), Type))
+		{
+			// Short cycle so every crop is watered and harvested within the run
+			if (ACultivo* Cultivo = Parcela->GetCurrentCultivo())
+			{
+				Cultivo->TiempoCrecimientoSegundos = Settings.GrowthTime;
+				Cultivo->IntervaloRiego = Settings.GrowthTime * 0.5f;
+				Cultivo->TiempoAntesDeSecar = Settings.GrowthTime * 2.0f;
+			}
+		}
+		Result.PlantMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+		++Result.PlantCalls;
+		break;
+	}
+
+	case EParcelaState::ConCultivo:
+	{
+		ACultivo* Cultivo = Parcela->GetCurrentCultivo();
+		if (!Cultivo)
+		{
+			break;
+		}
+
+		if (Cultivo->IsMature() || Cultivo->IsDry())
+		{
+			int32 Value = 0;
+			Parcela->HarvestCrop(Value);
+			Result.HarvestMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+			++Result.HarvestCalls;
+		}
+		else if (Cultivo->NeedsWater())
+		{
+			Cultivo->Water();
+			Result.WaterMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+			++Result.WaterCalls;
+		}
+		break;
+	}
+	}
+}
+
+bool UFarmStressCommandlet::WriteCsv(const FString& FilePath, const TArray<FRunResult>& Results)
+{
+	FString Csv = TEXT("Parcels,Frames,FrameMsAvg,FrameMsP50,FrameMsP95,FrameMsP99,FrameMsMax,WorldTickMsAvg,")
+		TEXT("SpawnMs,PrepareMs,PrepareCalls,PlantMs,PlantCalls,WaterMs,WaterCalls,HarvestMs,HarvestCalls,")
+		TEXT("MemBeforeMB,MemPeakMB,MemAfterMB,Allocs,Frees,AllocsPerFrame,FreesPerFrame,UObjectsBefore,UObjectsAfter,Actors,Components,TickingActors\n");
+
+	for (const FRunResult& R : Results)
+	{
+		Csv += FString::Printf(TEXT("%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f,%.3f,%d,%.3f,%d,%.3f,%d,%.3f,%d,%.1f,%.1f,%.1f,%llu,%llu,%.1f,%.1f,%d,%d,%d,%d,%d\n"),
+			R.ParcelCount, R.Frames, R.FrameMsAvg, R.FrameMsP50, R.FrameMsP95, R.FrameMsP99, R.FrameMsMax, R.WorldTickMsAvg,
+			R.SpawnMs, R.PrepareMs, R.PrepareCalls, R.PlantMs, R.PlantCalls, R.WaterMs, R.WaterCalls, R.HarvestMs, R.HarvestCalls,
+			R.MemUsedBeforeMB, R.MemUsedPeakMB, R.MemUsedAfterMB, R.Allocations, R.Frees, R.AllocsPerFrame, R.FreesPerFrame, R.UObjectsBefore, R.UObjectsAfter,
+			R.Actors, R.Components, R.TickingActors);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *FilePath);
+}
+
+bool UFarmStressCommandlet::WriteJson(const FString& FilePath, const FRunSettings& Settings, const TArray<FRunResult>& Results)
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("Map"), Settings.MapPath);
+	Root->SetNumberField(TEXT("Frames"), Settings.Frames);
+	Root->SetNumberField(TEXT("CycleFrames"), Settings.CycleFrames);
+	Root->SetNumberField(TEXT("DeltaTime"), Settings.DeltaTime);
+	Root->SetNumberField(TEXT("GrowthTime"), Settings.GrowthTime);
+	Root->SetStringField(TEXT("Commandline"), FCommandLine::Get());
+
+	TArray<TSharedPtr<FJsonValue>> Runs;
+	for (const FRunResult& R : Results)
+	{
+		TSharedRef<FJsonObject> Run = MakeShared<FJsonObject>();
+		Run->SetNumberField(TEXT("Parcels"), R.ParcelCount);
+
+		TSharedRef<FJsonObject> FrameMs = MakeShared<FJsonObject>();
+		FrameMs->SetNumberField(TEXT("Avg"), R.FrameMsAvg);
+		FrameMs->SetNumberField(TEXT("P50"), R.FrameMsP50);
+		FrameMs->SetNumberField(TEXT("P95"), R.FrameMsP95);
+		FrameMs->SetNumberField(TEXT("P99"), R.FrameMsP99);
+		FrameMs->SetNumberField(TEXT("Max"), R.FrameMsMax);
+		FrameMs->SetNumberField(TEXT("WorldTickAvg"), R.WorldTickMsAvg);
+		Run->SetObjectField(TEXT("GameThreadMs"), FrameMs);
+
+		auto MakeApi = [](double Ms, int32 Calls)
+		{
+			TSharedRef<FJsonObject> Api = MakeShared<FJsonObject>();
+			Api->SetNumberField(TEXT("TotalMs"), Ms);
+			Api->SetNumberField(TEXT("Calls"), Calls);
+			Api->SetNumberField(TEXT("UsPerCall"), Calls > 0 ? (Ms * 1000.0) / Calls : 0.0);
+			return Api;
+		};
+
+		TSharedRef<FJsonObject> Apis = MakeShared<FJsonObject>();
+		Apis->SetObjectField(TEXT("PrepareGround"), MakeApi(R.PrepareMs, R.PrepareCalls));
+		Apis->SetObjectField(TEXT("PlantCrop"), MakeApi(R.PlantMs, R.PlantCalls));
+		Apis->SetObjectField(TEXT("Water"), MakeApi(R.WaterMs, R.WaterCalls));
+		Apis->SetObjectField(TEXT("HarvestCrop"), MakeApi(R.HarvestMs, R.HarvestCalls));
+		Run->SetObjectField(TEXT("FarmApi"), Apis);
+		Run->SetNumberField(TEXT("SpawnMs"), R.SpawnMs);
+		if (Settings.bSpawnQueue)
+		{
+			Run->SetNumberField(TEXT("SpawnFrames"), R.SpawnFrames);
+			Run->SetNumberField(TEXT("SpawnFrameMsMax"), R.SpawnFrameMsMax);
+		}
+
+		TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+		Memory->SetNumberField(TEXT("UsedBeforeMB"), R.MemUsedBeforeMB);
+		Memory->SetNumberField(TEXT("UsedPeakMB"), R.MemUsedPeakMB);
+		Memory->SetNumberField(TEXT("UsedAfterMB"), R.MemUsedAfterMB);
+		Memory->SetNumberField(TEXT("Allocations"), static_cast<double>(R.Allocations));
+		Memory->SetNumberField(TEXT("Frees"), static_cast<double>(R.Frees));
+		Memory->SetNumberField(TEXT("AllocsPerFrame"), R.AllocsPerFrame);
+		Memory->SetNumberField(TEXT("FreesPerFrame"), R.FreesPerFrame);
+		Memory->SetNumberField(TEXT("UObjectsBefore"), R.UObjectsBefore);
+		Memory->SetNumberField(TEXT("UObjectsAfter"), R.UObjectsAfter);
+		Run->SetObjectField(TEXT("Memory"), Memory);
+
+		if (FFarmMemory::IsTrackingEnabled())
+		{
+			TSharedRef<FJsonObject> FarmMemory = MakeShared<FJsonObject>();
+			for (int32 Index = 0; Index < static_cast<int32>(EFarmMemorySystem::Count); ++Index)
+			{
+				TSharedRef<FJsonObject> System = MakeShared<FJsonObject>();
+				System->SetNumberField(TEXT("PeakMB"), R.FarmMemoryPeakMB[Index]);
+				System->SetNumberField(TEXT("BudgetMB"), R.FarmMemoryBudgetMB[Index]);
+				FarmMemory->SetObjectField(FFarmMemory::GetSystemName(static_cast<EFarmMemorySystem>(Index)), System);
+			}
+			Run->SetObjectField(TEXT("FarmMemory"), FarmMemory);
+
+			TArray<TSharedPtr<FJsonValue>> OverBudget;
+			for (const FString& System : R.OverBudgetSystems)
+			{
+				OverBudget.Add(MakeShared<FJsonValueString>(System));
+			}
+			Run->SetArrayField(TEXT("OverBudget"), OverBudget);
+		}
+
+		TSharedRef<FJsonObject> Objects = MakeShared<FJsonObject>();
+		Objects->SetNumberField(TEXT("Actors"), R.Actors);
+		Objects->SetNumberField(TEXT("Components"), R.Components);
+		Objects->SetNumberField(TEXT("TickingActors"), R.TickingActors);
+		Run->SetObjectField(TEXT("Objects"), Objects);
+
+		Runs.Add(MakeShared<FJsonValueObject>(Run));
+	}
+	Root->SetArrayField(TEXT("Runs"), Runs);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveStringToFile(Json, *FilePath);
+}
\ No newline at end of file
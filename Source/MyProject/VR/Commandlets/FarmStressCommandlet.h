@@ -0,0 +1,124 @@
+// ==================================================================
+// FarmStressCommandlet.h
+// Headless scaling benchmark for the farm simulation
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "FarmStressCommandlet.generated.h"
+
+class AParcelaTierra;
+class FFarmHeadlessWorld;
+
+/**
+ * Spawns N parcels per run and cycles them through PrepareGround / PlantCrop / Water / HarvestCrop
+ * for a fixed number of frames, then writes a CSV and JSON scaling report to Saved/FarmStress/.
+ *
+ *   UnrealEditor-Cmd MyProject.uproject -run=FarmStress -nullrhi -unattended
+ *       [-Map=/Game/Maps/Farm] [-Counts=100,1000,10000,50000] [-Frames=600] [-DeltaTime=0.0139]
+ *       [-CycleFrames=60] [-GrowthTime=2.0] [-Report=Name] [-SpawnQueue]
+ *
+ * -SpawnQueue loads the parcels through UFarmSpawnQueueSubsystem instead of in one frame and
+ * reports how many frames the load took and its worst frame.
+ *
+ * Per-system stat timings: add -trace=cpu,stats and open the .utrace in Unreal Insights; the
+ * report itself carries the game-thread frame times and the time spent inside each farm API,
+ * plus heap allocations and frees per frame (GMalloc is wrapped over the measured frames).
+ *
+ * With -llm the farm memory tags are checked against UFarmMemoryBudgetSubsystem's budgets
+ * during each run; the commandlet returns 1 if any system went over, so CI can gate on it.
+ * The MyProject.Farm.Stress.MemoryBudgets automation test runs the same scenario through RunCount.
+ */
+UCLASS()
+class MYPROJECT_API UFarmStressCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFarmStressCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	struct FRunSettings
+	{
+		FString MapPath;
+		int32 Frames = 600;
+		int32 CycleFrames = 60;
+		float DeltaTime = 1.0f / 72.0f;
+		float GrowthTime = 2.0f;
+		float Spacing = 150.0f;
+		bool bSpawnQueue = false;
+	};
+
+	struct FRunResult
+	{
+		int32 ParcelCount = 0;
+		int32 Frames = 0;
+
+		// Game-thread ms per frame (World->Tick plus the farm API calls)
+		float FrameMsAvg = 0.0f;
+		float FrameMsP50 = 0.0f;
+		float FrameMsP95 = 0.0f;
+		float FrameMsP99 = 0.0f;
+		float FrameMsMax = 0.0f;
+		float WorldTickMsAvg = 0.0f;
+
+		// Total ms and call count spent in each farm API
+		double PrepareMs = 0.0;
+		double PlantMs = 0.0;
+		double WaterMs = 0.0;
+		double HarvestMs = 0.0;
+		int32 PrepareCalls = 0;
+		int32 PlantCalls = 0;
+		int32 WaterCalls = 0;
+		int32 HarvestCalls = 0;
+
+		double SpawnMs = 0.0;
+
+		// With -SpawnQueue: frames until every parcel was spawned, and the slowest of them
+		int32 SpawnFrames = 0;
+		float SpawnFrameMsMax = 0.0f;
+
+		// Memory in MB, sampled every frame
+		double MemUsedBeforeMB = 0.0;
+		double MemUsedAfterMB = 0.0;
+		double MemUsedPeakMB = 0.0;
+		int32 UObjectsBefore = 0;
+		int32 UObjectsAfter = 0;
+
+		// Heap allocations and frees over the measured frames, all threads
+		uint64 Allocations = 0;
+		uint64 Frees = 0;
+		double AllocsPerFrame = 0.0;
+		double FreesPerFrame = 0.0;
+
+		int32 Actors = 0;
+		int32 Components = 0;
+		int32 TickingActors = 0;
+
+		// Peak LLM memory per farm system (MB) and its budget; empty without -llm
+		double FarmMemoryPeakMB[static_cast<int32>(EFarmMemorySystem::Count)] = {};
+		double FarmMemoryBudgetMB[static_cast<int32>(EFarmMemorySystem::Count)] = {};
+		TArray<FString> OverBudgetSystems;
+
+		// Budget checks that actually measured (LLM tracking on); 0 means nothing was checked
+		int32 BudgetSamples = 0;
+	};
+
+	// One run of the scenario in its own headless world
+	bool RunCount(int32 ParcelCount, const FRunSettings& Settings, FRunResult& OutResult);
+
+private:
+	void SpawnParcels(FFarmHeadlessWorld& HeadlessWorld, int32 ParcelCount, const FRunSettings& Settings, FRunResult& Result);
+	void StepParcel(int32 ParcelIndex, const FRunSettings& Settings, FRunResult& Result);
+	static void SampleMemoryBudgets(const UWorld* World, FRunResult& Result);
+
+	static bool WriteCsv(const FString& FilePath, const TArray<FRunResult>& Results);
+	static bool WriteJson(const FString& FilePath, const FRunSettings& Settings, const TArray<FRunResult>& Results);
+
+	UPROPERTY()
+	TArray<AParcelaTierra*> Parcels;
+};
\ No newline at end of file
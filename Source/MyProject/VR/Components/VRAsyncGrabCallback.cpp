@@ -0,0 +1,68 @@
+#include "VRAsyncGrabCallback.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+#include "Chaos/ParticleHandle.h"
+
+void FVRAsyncGrabCallback::OnPreSimulate_Internal()
+{
+    if (const FVRAsyncGrabInput* Input = GetConsumerInput_Internal())
+    {
+        Latest.Proxy = Input->Proxy;
+        Latest.TargetTransform = Input->TargetTransform;
+        Latest.TargetLinearVelocity = Input->TargetLinearVelocity;
+        Latest.MaxExtrapolationTime = Input->MaxExtrapolationTime;
+        Latest.LinearDriveStrength = Input->LinearDriveStrength;
+        Latest.AngularDriveStrength = Input->AngularDriveStrength;
+        Latest.MaxLinearSpeed = Input->MaxLinearSpeed;
+        Latest.MaxAngularSpeed = Input->MaxAngularSpeed;
+        Latest.bActive = Input->bActive;
+        StepsSinceInput = 0;
+    }
+
+    const float DeltaTime = GetDeltaTime_Internal();
+    if (!Latest.bActive || !Latest.Proxy || DeltaTime <= 0.0f)
+    {
+        return;
+    }
+
+    Chaos::FRigidBodyHandle_Internal* Body = Latest.Proxy->GetPhysicsThreadAPI();
+    if (!Body)
+    {
+        return;
+    }
+
+    if (Body->ObjectState() == Chaos::EObjectStateType::Sleeping)
+    {
+        Body->SetObjectState(Chaos::EObjectStateType::Dynamic);
+    }
+
+    // Predict where the hand will be at the end of this substep. No new input for longer than
+    // a game frame (controller still, tracking lost, hitch): hold the last pose instead of drifting
+    StepsSinceInput = FMath::Min(StepsSinceInput + 1, MaxStepsSinceInput);
+    const float ExtrapolationTime = StepsSinceInput * DeltaTime;
+    FVector TargetLocation = Latest.TargetTransform.GetLocation();
+    if (ExtrapolationTime <= Latest.MaxExtrapolationTime)
+    {
+        TargetLocation += Latest.TargetLinearVelocity * ExtrapolationTime;
+    }
+    const FQuat TargetRotation = Latest.TargetTransform.GetRotation();
+
+    // Linear: velocity that closes the error within one step
+    const FVector CurrentLocation = Body->X();
+    FVector DesiredVelocity = (TargetLocation - CurrentLocation) * (Latest.LinearDriveStrength / DeltaTime);
+    DesiredVelocity = DesiredVelocity.GetClampedToMaxSize(Latest.MaxLinearSpeed);
+
+    // Angular: shortest rotation from current to target
+    const FQuat CurrentRotation = Body->R();
+    FQuat DeltaRotation = TargetRotation * CurrentRotation.Inverse();
+    DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+
+    FVector Axis;
+    FQuat::FReal Angle = 0.0;
+    DeltaRotation.ToAxisAndAngle(Axis, Angle);
+
+    FVector DesiredAngularVelocity = Axis * (Angle * Latest.AngularDriveStrength / DeltaTime);
+    DesiredAngularVelocity = DesiredAngularVelocity.GetClampedToMaxSize(Latest.MaxAngularSpeed);
+
+    Body->SetV(DesiredVelocity);
+    Body->SetW(DesiredAngularVelocity);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Chaos/SimCallbackInput.h"
+
+class FSingleParticlePhysicsProxy;
+
+/**
+ * Latest grab target pushed from the game thread. Chaos marshals one of these
+ * per external step; every substep of that step consumes the newest one.
+ */
+struct FVRAsyncGrabInput : public Chaos::FSimCallbackInput
+{
+    FSingleParticlePhysicsProxy* Proxy = nullptr;
+
+    // World space target for the grabbed body (controller pose * grab offset)
+    FTransform TargetTransform = FTransform::Identity;
+
+    // Controller velocity, used to extrapolate the target between game frames
+    FVector TargetLinearVelocity = FVector::ZeroVector;
+
+    // Extrapolate at most this long past the input (one game frame); older input holds the pose
+    float MaxExtrapolationTime = 1.0f / 30.0f;
+
+    // 0-1: fraction of the position/rotation error corrected per physics step
+    float LinearDriveStrength = 1.0f;
+    float AngularDriveStrength = 1.0f;
+
+    float MaxLinearSpeed = 2000.0f;
+    float MaxAngularSpeed = 40.0f;
+
+    bool bActive = false;
+
+    void Reset()
+    {
+        Proxy = nullptr;
+        bActive = false;
+    }
+};
+
+/**
+ * Drives a grabbed rigid body towards the controller pose from inside the
+ * Chaos solver (OnPreSimulate_Internal), once per physics substep. Runs on the
+ * physics thread when async physics is enabled, and inside the solver step on
+ * the game thread otherwise; in both cases there is no component tick.
+ */
+class MYPROJECT_API FVRAsyncGrabCallback : public Chaos::TSimCallbackObject<
+    FVRAsyncGrabInput,
+    Chaos::FSimCallbackNoOutput,
+    Chaos::ESimCallbackOptions::Presimulate>
+{
+protected:
+    virtual void OnPreSimulate_Internal() override;
+
+private:
+    // Copy of the last consumed input, reused by substeps without a new one
+    FVRAsyncGrabInput Latest;
+    int32 StepsSinceInput = 0;
+
+    // Only needs to count past MaxExtrapolationTime; keeps the counter from overflowing
+    static constexpr int32 MaxStepsSinceInput = 1024;
+};
@@ -1,9 +1,14 @@
 #include "VRDiggingToolComponent.h"
-#include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "Components/StaticMeshComponent.h"
+#include "VRGrabComponent.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Diagnostics/FarmDebugDraw.h"
 #include "Kismet/GameplayStatics.h"
 
+DECLARE_CYCLE_STAT(TEXT("Digging Tool Component Tick"), STAT_FarmDiggingToolComponentTick, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Digging Tool Query"), STAT_FarmDiggingToolQuery, STATGROUP_HarvestHaven);
+
 UVRDiggingToolComponent::UVRDiggingToolComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -20,22 +25,32 @@ void UVRDiggingToolComponent::BeginPlay()
 		ToolMesh = GetOwner()->FindComponentByClass<UStaticMeshComponent>();
 	}
 
-	LastTipPosition = GetToolTipLocation();
+	OwnerGrabComponent = GetOwner()->FindComponentByClass<UVRGrabComponent>();
+
+	LastTipPosition = GetPredictedToolTipLocation();
 	
 	UE_LOG(LogTemp, Log, TEXT("DiggingTool: Initialized on %s"), *GetOwner()->GetName());
 }
 
 void UVRDiggingToolComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDiggingToolComponentTick);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	if (bIsDigging && ToolMesh)
 	{
+		if (SampleMode == EDigSampleMode::Swept)
+		{
+			TickSwept(DeltaTime);
+			return;
+		}
+
 		UpdateVelocity(DeltaTime);
 
 		// Debug: Visualizar la punta
-		FVector TipLocation = GetToolTipLocation();
-		DrawDebugSphere(GetWorld(), TipLocation, DigRadius, 8, FColor::Yellow, false, -1.0f, 0, 2.0f);
+		FVector TipLocation = GetPredictedToolTipLocation();
+		FARM_DEBUG_DRAW(Digging, Sphere, this, TipLocation, DigRadius, 8, FColor::Yellow, 0.0f, 2.0f);
 
 		if (ShouldDig())
 		{
@@ -48,8 +63,9 @@ void UVRDiggingToolComponent::StartDigging()
 {
 	bIsDigging = true;
 	SetComponentTickEnabled(true);
-	LastTipPosition = GetToolTipLocation();
+	LastTipPosition = GetPredictedToolTipLocation();
 	CurrentTipVelocity = FVector::ZeroVector;
+	ResetSweepState();
 	
 	UE_LOG(LogTemp, Log, TEXT("DiggingTool: Started digging"));
 }
@@ -78,15 +94,32 @@ FVector UVRDiggingToolComponent::GetToolTipLocation() const
 		   ToolMesh->GetComponentRotation().RotateVector(ToolTipOffset);
 }
 
+FVector UVRDiggingToolComponent::GetPredictedToolTipLocation() const
+{
+	if (!ToolMesh || !OwnerGrabComponent)
+		return GetToolTipLocation();
+
+	const FTransform MeshTransform = OwnerGrabComponent->GetPredictedComponentTransform(ToolMesh);
+
+	if (ToolMesh->DoesSocketExist(ToolTipSocketName))
+	{
+		return MeshTransform.TransformPosition(ToolMesh->GetSocketTransform(ToolTipSocketName, RTS_Component).GetLocation());
+	}
+
+	return MeshTransform.GetLocation() + MeshTransform.GetRotation().RotateVector(ToolTipOffset);
+}
+
 bool UVRDiggingToolComponent::TryDigAtLocation(const FVector& Location)
 {
 	if (!GetWorld())
 		return false;
 
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDiggingToolQuery);
+	FARM_COUNTER_INC(SceneQueries);
+
 	// Sphere overlap en la punta
 	TArray<FOverlapResult> OverlapResults;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(GetOwner());
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DiggingToolOverlap), false, GetOwner());
 
 	bool bHit = GetWorld()->OverlapMultiByChannel(
 		OverlapResults,
@@ -101,38 +134,9 @@ bool UVRDiggingToolComponent::TryDigAtLocation(const FVector& Location)
 	{
 		for (const FOverlapResult& Result : OverlapResults)
 		{
-			if (AActor* HitActor = Result.GetActor())
+			if (DigActorAtLocation(Result.GetActor(), Location, CurrentTipVelocity.GetSafeNormal()))
 			{
-				// Verificar si tiene el tag "Diggable"
-				if (HitActor->Tags.Contains(FName("Diggable")))
-				{
-					// Llamar función OnDig en el actor
-					if (UFunction* DigFunction = HitActor->GetClass()->FindFunctionByName(FName("OnDig")))
-					{
-						struct FDigParams
-						{
-							FVector Location;
-							float Radius;
-							float Depth;
-							FVector ImpactNormal;
-						};
-
-						FDigParams Params;
-						Params.Location = Location;
-						Params.Radius = DigRadius;
-						Params.Depth = DigDepth;
-						Params.ImpactNormal = CurrentTipVelocity.GetSafeNormal();
-
-						HitActor->ProcessEvent(DigFunction, &Params);
-
-						// Feedback visual
-						DrawDebugSphere(GetWorld(), Location, DigRadius, 12, FColor::Red, false, 1.0f, 0, 3.0f);
-						UE_LOG(LogTemp, Log, TEXT("DiggingTool: Dug at %s with velocity %.2f"), 
-							*Location.ToString(), CurrentTipVelocity.Size());
-
-						return true;
-					}
-				}
+				return true;
 			}
 		}
 	}
@@ -140,12 +144,228 @@ bool UVRDiggingToolComponent::TryDigAtLocation(const FVector& Location)
 	return false;
 }
 
+bool UVRDiggingToolComponent::DigActorAtLocation(AActor* HitActor, const FVector& Location, const FVector& ImpactNormal)
+{
+	FARM_TRACE_EVENT_SCOPE(Farm_DigActor);
+
+	// Verificar si tiene el tag "Diggable"
+	if (!HitActor || !HitActor->Tags.Contains(FName("Diggable")))
+	{
+		return false;
+	}
+
+	// Llamar función OnDig en el actor
+	UFunction* DigFunction = HitActor->GetClass()->FindFunctionByName(FName("OnDig"));
+	if (!DigFunction)
+	{
+		return false;
+	}
+
+	struct FDigParams
+	{
+		FVector Location;
+		float Radius;
+		float Depth;
+		FVector ImpactNormal;
+	};
+
+	FDigParams Params;
+	Params.Location = Location;
+	Params.Radius = DigRadius;
+	Params.Depth = DigDepth;
+	Params.ImpactNormal = ImpactNormal;
+
+	HitActor->ProcessEvent(DigFunction, &Params);
+
+	// Feedback visual
+	FARM_DEBUG_DRAW(Digging, Sphere, this, Location, DigRadius, 12, FColor::Red, 1.0f, 3.0f);
+	UE_LOG(LogTemp, Log, TEXT("DiggingTool: Dug at %s with velocity %.2f"), 
+		*Location.ToString(), CurrentTipVelocity.Size());
+
+	return true;
+}
+
+// ============================================================
+// SWEPT MODE
+// ============================================================
+
+void UVRDiggingToolComponent::ResetSweepState()
+{
+	PendingTipPath.Reset();
+	PendingTipPath.Add(LastTipPosition);
+	TimeSinceLastSweep = 0.0f;
+	DistanceSinceLastStamp = 0.0f;
+	StampBudget = 1.0f;
+}
+
+void UVRDiggingToolComponent::TickSwept(float DeltaTime)
+{
+	// UpdateVelocity deja la posición actual de la punta en LastTipPosition
+	UpdateVelocity(DeltaTime);
+
+	// Debug: Visualizar la punta
+	FARM_DEBUG_DRAW(Digging, Sphere, this, LastTipPosition, DigRadius, 8, FColor::Yellow, 0.0f, 2.0f);
+
+	// Presupuesto de marcas: se recarga con el tiempo, no con los frames
+	const float MaxBurst = FMath::Max(1.0f, MaxStampsPerSecond / MaxSweepsPerSecond);
+	StampBudget = FMath::Min(StampBudget + DeltaTime * MaxStampsPerSecond, MaxBurst);
+
+	// Registrar el camino de la punta (solo si se movió)
+	if (PendingTipPath.Num() == 0 || !PendingTipPath.Last().Equals(LastTipPosition, KINDA_SMALL_NUMBER))
+	{
+		PendingTipPath.Add(LastTipPosition);
+	}
+
+	// Limitar el número de barridos por segundo, independiente del framerate
+	TimeSinceLastSweep += DeltaTime;
+	if (TimeSinceLastSweep < 1.0f / MaxSweepsPerSecond)
+	{
+		return;
+	}
+
+	SweepPendingPath(TimeSinceLastSweep);
+	TimeSinceLastSweep = 0.0f;
+}
+
+void UVRDiggingToolComponent::SweepPendingPath(float ElapsedTime)
+{
+	const int32 LastIndex = PendingTipPath.Num() - 1;
+	if (LastIndex < 1 || ElapsedTime <= 0.0f)
+	{
+		return;
+	}
+
+	float PathLength = 0.0f;
+	for (int32 Index = 1; Index <= LastIndex; ++Index)
+	{
+		PathLength += FVector::Dist(PendingTipPath[Index - 1], PendingTipPath[Index]);
+	}
+
+	// Velocidad media de la punta en la ventana del barrido
+	if (PathLength / ElapsedTime >= MinVelocityToDigCm)
+	{
+		// Dividir el camino en como mucho MaxSegmentsPerSweep segmentos: un barrido por segmento
+		const int32 NumSegments = FMath::Clamp(MaxSegmentsPerSweep, 1, LastIndex);
+		int32 PrevIndex = 0;
+
+		for (int32 Segment = 1; Segment <= NumSegments; ++Segment)
+		{
+			const int32 Index = (Segment == NumSegments) ? LastIndex : (Segment * LastIndex) / NumSegments;
+			if (Index <= PrevIndex)
+			{
+				continue;
+			}
+
+			SweepSegment(PendingTipPath[PrevIndex], PendingTipPath[Index]);
+			PrevIndex = Index;
+		}
+	}
+	else
+	{
+		DistanceSinceLastStamp = 0.0f;
+	}
+
+	// El siguiente camino empieza donde terminó este
+	const FVector LastPoint = PendingTipPath[LastIndex];
+	PendingTipPath.Reset();
+	PendingTipPath.Add(LastPoint);
+}
+
+bool UVRDiggingToolComponent::SweepSegment(const FVector& SegmentStart, const FVector& SegmentEnd)
+{
+	UWorld* World = GetWorld();
+	const FVector Delta = SegmentEnd - SegmentStart;
+	const float SegmentLength = Delta.Size();
+
+	if (!World || SegmentLength <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDiggingToolQuery);
+	FARM_COUNTER_INC(SceneQueries);
+
+	// Una esfera barrida a lo largo del segmento = una cápsula
+	TArray<FHitResult> HitResults;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DiggingToolSweep), false, GetOwner());
+
+	World->SweepMultiByChannel(
+		HitResults,
+		SegmentStart,
+		SegmentEnd,
+		FQuat::Identity,
+		ECC_WorldStatic,
+		FCollisionShape::MakeSphere(DigRadius),
+		QueryParams
+	);
+
+	const FHitResult* DiggableHit = HitResults.FindByPredicate([](const FHitResult& Hit)
+	{
+		const AActor* HitActor = Hit.GetActor();
+		return HitActor && HitActor->Tags.Contains(FName("Diggable"));
+	});
+
+	if (!DiggableHit)
+	{
+		DistanceSinceLastStamp = 0.0f;
+		return false;
+	}
+
+	const FVector Direction = Delta / SegmentLength;
+	AActor* HitActor = DiggableHit->GetActor();
+	const UPrimitiveComponent* HitComponent = DiggableHit->GetComponent();
+	// Un poco más grande que la punta: en el punto de impacto la esfera solo toca la superficie
+	const FCollisionShape TipShape = FCollisionShape::MakeSphere(DigRadius + 1.0f);
+
+	// Si ya empezamos dentro del terreno el contacto continúa: respetar el espaciado acumulado.
+	// Si es un contacto nuevo, la primera marca va en el punto de impacto.
+	float NextStampDistance = 0.0f;
+	float LastStampDistance = 0.0f;
+	if (DiggableHit->bStartPenetrating && DistanceSinceLastStamp > 0.0f)
+	{
+		NextStampDistance = FMath::Max(0.0f, StampSpacing - DistanceSinceLastStamp);
+		LastStampDistance = -DistanceSinceLastStamp;
+	}
+	else
+	{
+		NextStampDistance = DiggableHit->bStartPenetrating ? 0.0f : DiggableHit->Time * SegmentLength;
+		LastStampDistance = NextStampDistance - StampSpacing;
+	}
+
+	bool bDugAny = false;
+
+	while (NextStampDistance <= SegmentLength && StampBudget >= 1.0f)
+	{
+		const FVector StampLocation = SegmentStart + Direction * NextStampDistance;
+
+		// Solo a lo largo del contacto: si la punta ya salió del terreno no se marca en el aire
+		// (una consulta contra el componente golpeado, no contra toda la escena)
+		if (!HitComponent || !HitComponent->OverlapComponent(StampLocation, FQuat::Identity, TipShape))
+		{
+			DistanceSinceLastStamp = 0.0f;
+			return bDugAny;
+		}
+
+		if (DigActorAtLocation(HitActor, StampLocation, Direction))
+		{
+			StampBudget -= 1.0f;
+			bDugAny = true;
+		}
+
+		LastStampDistance = NextStampDistance;
+		NextStampDistance += StampSpacing;
+	}
+
+	DistanceSinceLastStamp = FMath::Max(0.0f, SegmentLength - LastStampDistance);
+	return bDugAny;
+}
+
 void UVRDiggingToolComponent::UpdateVelocity(float DeltaTime)
 {
 	if (DeltaTime <= 0.0f)
 		return;
 
-	FVector CurrentTipPosition = GetToolTipLocation();
+	FVector CurrentTipPosition = GetPredictedToolTipLocation();
 	CurrentTipVelocity = (CurrentTipPosition - LastTipPosition) / DeltaTime;
 	LastTipPosition = CurrentTipPosition;
 }
@@ -4,6 +4,14 @@
 #include "Components/ActorComponent.h"
 #include "VRDiggingToolComponent.generated.h"
 
+// Modo de muestreo de la punta de la pala
+UENUM(BlueprintType)
+enum class EDigSampleMode : uint8
+{
+	Discrete UMETA(DisplayName = "Discrete (overlap por frame)"),
+	Swept UMETA(DisplayName = "Swept (barrido continuo)")
+};
+
 UCLASS(BlueprintType, Blueprintable, ClassGroup=(VR), meta=(BlueprintSpawnableComponent))
 class MYPROJECT_API UVRDiggingToolComponent : public UActorComponent
 {
@@ -29,15 +37,45 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config")
 	FVector ToolTipOffset = FVector(0.0f, 0.0f, -50.0f); // Si no hay socket
 
+	// Discrete: overlap en la punta cada frame. Swept: barrido del camino de la punta
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config|Swept")
+	EDigSampleMode SampleMode = EDigSampleMode::Swept;
+
+	// Máximo de barridos por segundo (cada barrido lanza como mucho MaxSegmentsPerSweep queries)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config|Swept", meta = (ClampMin = "1.0"))
+	float MaxSweepsPerSecond = 15.0f;
+
+	// Segmentos en los que se divide el camino acumulado en cada barrido
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config|Swept", meta = (ClampMin = "1"))
+	int32 MaxSegmentsPerSweep = 2;
+
+	// Distancia entre marcas de excavación a lo largo del contacto (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config|Swept", meta = (ClampMin = "1.0"))
+	float StampSpacing = 10.0f;
+
+	// Máximo de marcas por segundo (se permite una pequeña ráfaga acumulada)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Digging Config|Swept", meta = (ClampMin = "1.0"))
+	float MaxStampsPerSecond = 20.0f;
+
 	// Referencias
 	UPROPERTY()
 	UStaticMeshComponent* ToolMesh = nullptr;
 
+	// Grab component del dueño, para leer la pose predicha de la mano
+	UPROPERTY()
+	class UVRGrabComponent* OwnerGrabComponent = nullptr;
+
 	// Estado
 	FVector LastTipPosition;
 	FVector CurrentTipVelocity;
 	bool bIsDigging = false;
 
+	// Estado del modo Swept: camino de la punta desde el último barrido
+	TArray<FVector> PendingTipPath;
+	float TimeSinceLastSweep = 0.0f;
+	float DistanceSinceLastStamp = 0.0f;
+	float StampBudget = 0.0f;
+
 public:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -57,7 +95,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Digging")
 	FVector GetToolTipLocation() const;
 
+	// Punta con la pose predicha del mando (la misma con la que se renderiza la pala)
+	UFUNCTION(BlueprintPure, Category = "Digging")
+	FVector GetPredictedToolTipLocation() const;
+
 private:
 	void UpdateVelocity(float DeltaTime);
 	bool ShouldDig() const;
+
+	// Modo Swept
+	void ResetSweepState();
+	void TickSwept(float DeltaTime);
+	void SweepPendingPath(float ElapsedTime);
+	bool SweepSegment(const FVector& SegmentStart, const FVector& SegmentEnd);
+
+	// Llama OnDig en un actor "Diggable"
+	bool DigActorAtLocation(AActor* HitActor, const FVector& Location, const FVector& ImpactNormal);
 };
\ No newline at end of file
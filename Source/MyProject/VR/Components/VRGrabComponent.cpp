@@ -2,9 +2,25 @@
 #include "Components/PrimitiveComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/Actor.h"
+#include "VRAsyncGrabCallback.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+#include "IMotionController.h"
+#include "Features/IModularFeatures.h"
+#include "GameFramework/WorldSettings.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmPhysicsSleepSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Grab Component Tick"), STAT_FarmGrabComponentTick, STATGROUP_HarvestHaven);
 
 UVRGrabComponent::UVRGrabComponent()
 {
+    FARM_LLM_SCOPE(Grabbables);
+
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.bStartWithTickEnabled = false;
     
@@ -23,10 +39,41 @@ void UVRGrabComponent::BeginPlay()
         UE_LOG(LogTemp, Warning, TEXT("VRGrabComponent: No valid primitive component found on %s"), 
             *GetOwner()->GetName());
     }
+    else if (bAllowPhysicsSleep && !UFarmActorPoolSubsystem::IsPooled(GetOwner()))
+    {
+        if (UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this))
+        {
+            SleepSubsystem->RegisterBody(GrabbedComponent);
+        }
+    }
+}
+
+void UVRGrabComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (bIsGrabbed)
+    {
+        FARM_COUNTER_DEC(GrabbablesHeld);
+    }
+
+    if (bIsGrabbed && GrabType == EGrabType::AsyncPhysics)
+    {
+        ReleaseFromAsyncPhysics();
+    }
+
+    UnregisterAsyncGrabCallback();
+
+    if (UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this))
+    {
+        SleepSubsystem->UnregisterBody(GrabbedComponent);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UVRGrabComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    FARM_SCOPE_CYCLE_COUNTER(STAT_FarmGrabComponentTick);
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     if (bIsGrabbed && GrabType == EGrabType::PhysicsHandle)
@@ -42,8 +89,18 @@ bool UVRGrabComponent::TryGrab(UMotionControllerComponent* Controller)
         return false;
     }
 
+    FARM_TRACE_EVENT_SCOPE(Farm_Grab);
+
     GrabbingController = Controller;
     bIsGrabbed = true;
+    FARM_COUNTER_INC(GrabbablesHeld);
+
+    // A demoted body is restored first so the original physics state is the simulated one
+    UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this);
+    if (SleepSubsystem)
+    {
+        SleepSubsystem->SetBodyHeld(GrabbedComponent, true);
+    }
 
     // Store original physics state
     bWasSimulatingPhysics = GrabbedComponent->IsSimulatingPhysics();
@@ -58,6 +115,10 @@ bool UVRGrabComponent::TryGrab(UMotionControllerComponent* Controller)
     case EGrabType::PhysicsHandle:
         GrabWithPhysicsHandle(Controller);
         break;
+
+    case EGrabType::AsyncPhysics:
+        GrabWithAsyncPhysics(Controller);
+        break;
         
     case EGrabType::Custom:
         // Override this in Blueprint or child classes
@@ -67,10 +128,38 @@ bool UVRGrabComponent::TryGrab(UMotionControllerComponent* Controller)
     // Broadcast grab event
     OnToolGrabbed.Broadcast();
 
-    UE_LOG(LogTemp, Log, TEXT("VRGrabComponent: Object grabbed - %s"), *GetOwner()->GetName());
+    FARM_EVENT(Grabbed, GetOwner(), static_cast<float>(GrabType));
+    UE_LOG(LogHarvestHaven, Verbose, TEXT("VRGrabComponent: Object grabbed - %s"), *GetOwner()->GetName());
     return true;
 }
 
+void UVRGrabComponent::SetPooled(bool bPooled)
+{
+    if (bPooled)
+    {
+        TryRelease();
+    }
+
+    if (!GrabbedComponent || !bAllowPhysicsSleep)
+    {
+        return;
+    }
+
+    if (UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this))
+    {
+        if (bPooled)
+        {
+            // A demoted body goes back to its original physics setup before the pool stores it
+            SleepSubsystem->WakeBody(GrabbedComponent);
+            SleepSubsystem->UnregisterBody(GrabbedComponent);
+        }
+        else
+        {
+            SleepSubsystem->RegisterBody(GrabbedComponent);
+        }
+    }
+}
+
 bool UVRGrabComponent::TryRelease()
 {
     if (!bIsGrabbed)
@@ -78,6 +167,8 @@ bool UVRGrabComponent::TryRelease()
         return false;
     }
 
+    FARM_TRACE_EVENT_SCOPE(Farm_Release);
+
     switch (GrabType)
     {
     case EGrabType::Attach:
@@ -87,6 +178,10 @@ bool UVRGrabComponent::TryRelease()
     case EGrabType::PhysicsHandle:
         ReleaseFromPhysicsHandle();
         break;
+
+    case EGrabType::AsyncPhysics:
+        ReleaseFromAsyncPhysics();
+        break;
         
     case EGrabType::Custom:
         // Override this in Blueprint or child classes
@@ -96,11 +191,18 @@ bool UVRGrabComponent::TryRelease()
     bIsGrabbed = false;
     GrabbingController = nullptr;
     SetComponentTickEnabled(false);
+    FARM_COUNTER_DEC(GrabbablesHeld);
+
+    if (UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this))
+    {
+        SleepSubsystem->SetBodyHeld(GrabbedComponent, false);
+    }
 
     // Broadcast release event
     OnToolReleased.Broadcast();
 
-    UE_LOG(LogTemp, Log, TEXT("VRGrabComponent: Object released - %s"), *GetOwner()->GetName());
+    FARM_EVENT(Released, GetOwner(), static_cast<float>(GrabType));
+    UE_LOG(LogHarvestHaven, Verbose, TEXT("VRGrabComponent: Object released - %s"), *GetOwner()->GetName());
     return true;
 }
 
@@ -129,7 +231,14 @@ void UVRGrabComponent::GrabWithAttach(UMotionControllerComponent* Controller)
     GrabbedComponent->SetSimulatePhysics(false);
     GrabbedComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 
-    // Attach to controller
+    // Attach to controller. Everything attached below the controller gets its late update
+    // on the render thread, so the held object is drawn with the same pose as the hand.
+    if (Controller->bDisableLowLatencyUpdate)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VRGrabComponent: %s has late update disabled, held object will lag a frame"),
+            *Controller->GetName());
+    }
+
     FAttachmentTransformRules AttachRules(
         EAttachmentRule::KeepWorld,
         EAttachmentRule::KeepWorld,
@@ -271,9 +380,221 @@ UPhysicsHandleComponent* UVRGrabComponent::GetOrCreatePhysicsHandle()
     // Create one if it doesn't exist
     if (!PhysicsHandle)
     {
+        FARM_LLM_SCOPE(Grabbables);
         PhysicsHandle = NewObject<UPhysicsHandleComponent>(GetOwner(), UPhysicsHandleComponent::StaticClass());
         PhysicsHandle->RegisterComponent();
     }
 
     return PhysicsHandle;
+}
+
+void UVRGrabComponent::GrabWithAsyncPhysics(UMotionControllerComponent* Controller)
+{
+    if (!GrabbedComponent || !Controller || !GetWorld())
+    {
+        return;
+    }
+
+    FPhysScene* PhysScene = GetWorld()->GetPhysicsScene();
+    if (!PhysScene || !PhysScene->GetSolver())
+    {
+        UE_LOG(LogTemp, Error, TEXT("VRGrabComponent: No physics scene for async grab"));
+        return;
+    }
+
+    // Ensure physics is enabled
+    if (!GrabbedComponent->IsSimulatingPhysics())
+    {
+        GrabbedComponent->SetSimulatePhysics(true);
+    }
+    GrabbedComponent->WakeAllRigidBodies();
+
+    if (!AsyncGrabCallback)
+    {
+        AsyncGrabCallback = PhysScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FVRAsyncGrabCallback>();
+    }
+
+    // Keep the pose the object had relative to the hand when grabbed
+    AsyncGrabRelativeTransform = GrabbedComponent->GetComponentTransform().GetRelativeTransform(Controller->GetComponentTransform());
+    LastControllerLocation = Controller->GetComponentLocation();
+    LastControllerSampleTime = GetWorld()->GetTimeSeconds();
+
+    // The controller pushes its pose whenever it moves; no tick on this component
+    ControllerTransformUpdatedHandle = Controller->TransformUpdated.AddUObject(this, &UVRGrabComponent::OnControllerTransformUpdated);
+
+    PushAsyncGrabTarget(true);
+}
+
+void UVRGrabComponent::ReleaseFromAsyncPhysics()
+{
+    if (GrabbingController && ControllerTransformUpdatedHandle.IsValid())
+    {
+        GrabbingController->TransformUpdated.Remove(ControllerTransformUpdatedHandle);
+    }
+    ControllerTransformUpdatedHandle.Reset();
+
+    // The body keeps the velocity the drive gave it, which acts as the throw
+    UnregisterAsyncGrabCallback();
+
+    // Restore original physics state if not dropping with physics
+    if (!bSimulatePhysicsOnDrop && GrabbedComponent)
+    {
+        GrabbedComponent->SetSimulatePhysics(bWasSimulatingPhysics);
+        GrabbedComponent->SetCollisionEnabled(OriginalCollisionEnabled);
+    }
+}
+
+void UVRGrabComponent::OnControllerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    if (bIsGrabbed && GrabType == EGrabType::AsyncPhysics)
+    {
+        PushAsyncGrabTarget(true);
+    }
+}
+
+void UVRGrabComponent::PushAsyncGrabTarget(bool bActive)
+{
+    if (!AsyncGrabCallback || !GrabbingController || !GrabbedComponent || !GetWorld())
+    {
+        return;
+    }
+
+    FVRAsyncGrabInput* Input = AsyncGrabCallback->GetProducerInputData_External();
+    if (!Input)
+    {
+        return;
+    }
+
+    const FTransform ControllerTransform = GrabbingController->GetComponentTransform();
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Elapsed = Now - LastControllerSampleTime;
+
+    // Several updates in the same frame keep the previous velocity estimate
+    if (Elapsed > UE_KINDA_SMALL_NUMBER)
+    {
+        Input->TargetLinearVelocity = (ControllerTransform.GetLocation() - LastControllerLocation) / Elapsed;
+        LastControllerLocation = ControllerTransform.GetLocation();
+        LastControllerSampleTime = Now;
+    }
+
+    FBodyInstance* BodyInstance = GrabbedComponent->GetBodyInstance();
+    Input->Proxy = BodyInstance ? BodyInstance->GetPhysicsActorHandle() : nullptr;
+    Input->TargetTransform = AsyncGrabRelativeTransform * ControllerTransform;
+    Input->MaxExtrapolationTime = FMath::Max(GetWorld()->GetDeltaSeconds(), 1.0f / 90.0f);
+    Input->LinearDriveStrength = AsyncLinearDriveStrength;
+    Input->AngularDriveStrength = AsyncAngularDriveStrength;
+    Input->MaxLinearSpeed = AsyncMaxLinearSpeed;
+    Input->MaxAngularSpeed = AsyncMaxAngularSpeed;
+    Input->bActive = bActive && Input->Proxy != nullptr;
+}
+
+void UVRGrabComponent::UnregisterAsyncGrabCallback()
+{
+    if (!AsyncGrabCallback)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (FPhysScene* PhysScene = World->GetPhysicsScene())
+        {
+            if (PhysScene->GetSolver())
+            {
+                PhysScene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(AsyncGrabCallback);
+            }
+        }
+    }
+
+    AsyncGrabCallback = nullptr;
+}
+
+namespace VRGrab
+{
+    // The tracked pose is relative to the controller's parent (VROrigin)
+    static FTransform GetControllerParentTransform(const UMotionControllerComponent* Controller)
+    {
+        const USceneComponent* Parent = Controller->GetAttachParent();
+        return Parent ? Parent->GetSocketTransform(Controller->GetAttachSocketName()) : FTransform::Identity;
+    }
+}
+
+bool UVRGrabComponent::PollControllerTransform(const UMotionControllerComponent* Controller, FTransform& OutWorldTransform)
+{
+    FTransform TrackedTransform;
+    if (!PollTrackedTransform(Controller, TrackedTransform))
+    {
+        return false;
+    }
+
+    OutWorldTransform = TrackedTransform * VRGrab::GetControllerParentTransform(Controller);
+    return true;
+}
+
+bool UVRGrabComponent::PollTrackedTransform(const UMotionControllerComponent* Controller, FTransform& OutTrackedTransform)
+{
+    if (!Controller || !Controller->GetWorld())
+    {
+        return false;
+    }
+
+    const float WorldToMeters = Controller->GetWorld()->GetWorldSettings()->WorldToMeters;
+    // Walked in place: GetModularFeatureImplementations would build a new array on every poll
+    IModularFeatures& ModularFeatures = IModularFeatures::Get();
+    const FName FeatureName = IMotionController::GetModularFeatureName();
+    const int32 NumMotionControllers = ModularFeatures.GetModularFeatureImplementationCount(FeatureName);
+
+    for (int32 Index = 0; Index < NumMotionControllers; ++Index)
+    {
+        IMotionController* MotionController = static_cast<IMotionController*>(ModularFeatures.GetModularFeatureImplementation(FeatureName, Index));
+        FRotator Orientation;
+        FVector Position;
+        if (MotionController && MotionController->GetControllerOrientationAndPosition(Controller->PlayerIndex, Controller->MotionSource, Orientation, Position, WorldToMeters))
+        {
+            OutTrackedTransform = FTransform(Orientation, Position, Controller->GetRelativeScale3D());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+FTransform UVRGrabComponent::GetPredictedControllerTransform() const
+{
+    if (!GrabbingController)
+    {
+        return FTransform::Identity;
+    }
+
+    // Held tools read the pose several times per tick (the watering can three); the XR system is
+    // polled once per frame, while the parent transform is re-read since the pawn may move meanwhile
+    if (CachedTrackedFrame != GFrameCounter || CachedTrackedController.Get() != GrabbingController)
+    {
+        bCachedTrackedValid = PollTrackedTransform(GrabbingController, CachedTrackedTransform);
+        CachedTrackedController = GrabbingController;
+        CachedTrackedFrame = GFrameCounter;
+    }
+
+    if (bCachedTrackedValid)
+    {
+        return CachedTrackedTransform * VRGrab::GetControllerParentTransform(GrabbingController);
+    }
+
+    return GrabbingController->GetComponentTransform();
+}
+
+FTransform UVRGrabComponent::GetPredictedComponentTransform(const USceneComponent* Component) const
+{
+    if (!Component)
+    {
+        return FTransform::Identity;
+    }
+
+    if (!bIsGrabbed || !GrabbingController || GrabType != EGrabType::Attach)
+    {
+        return Component->GetComponentTransform();
+    }
+
+    const FTransform RelativeToController = Component->GetComponentTransform().GetRelativeTransform(GrabbingController->GetComponentTransform());
+    return RelativeToController * GetPredictedControllerTransform();
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "PhysicsEngine/PhysicsHandleComponent.h"
 #include "VRGrabComponent.generated.h"
 
+class FVRAsyncGrabCallback;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnToolGrabbed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnToolReleased);
 
@@ -14,7 +16,8 @@ enum class EGrabType : uint8
 {
     PhysicsHandle UMETA(DisplayName = "Physics Handle"),
     Attach UMETA(DisplayName = "Attach to Hand"),
-    Custom UMETA(DisplayName = "Custom")
+    Custom UMETA(DisplayName = "Custom"),
+    AsyncPhysics UMETA(DisplayName = "Async Physics (Chaos substep)")
 };
 
 UCLASS(BlueprintType, Blueprintable, ClassGroup=(VR), meta=(BlueprintSpawnableComponent))
@@ -40,6 +43,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config")
     bool bSimulatePhysicsOnDrop = true;
 
+    // Let the physics sleep manager demote this body once it settles after a drop
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config")
+    bool bAllowPhysicsSleep = true;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config")
     FName GrabSocketName = NAME_None;
 
@@ -62,6 +69,19 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config|Physics Handle")
     float PhysicsHandleAngularStiffness = 1500.0f;
 
+    // Async Physics Settings (fraction of the pose error corrected per physics substep)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config|Async Physics", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float AsyncLinearDriveStrength = 0.9f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config|Async Physics", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float AsyncAngularDriveStrength = 0.9f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config|Async Physics")
+    float AsyncMaxLinearSpeed = 2000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Grab Config|Async Physics")
+    float AsyncMaxAngularSpeed = 40.0f;
+
     // State
     UPROPERTY(BlueprintReadOnly, Category = "VR Grab State")
     bool bIsGrabbed = false;
@@ -79,8 +99,22 @@ protected:
     bool bWasSimulatingPhysics = false;
     ECollisionEnabled::Type OriginalCollisionEnabled;
 
+    // Async physics grab state
+    FVRAsyncGrabCallback* AsyncGrabCallback = nullptr;
+    FDelegateHandle ControllerTransformUpdatedHandle;
+    FTransform AsyncGrabRelativeTransform = FTransform::Identity;
+    FVector LastControllerLocation = FVector::ZeroVector;
+    double LastControllerSampleTime = 0.0;
+
+    // GrabbingController's tracked pose (relative to its parent), polled from the XR system once per frame
+    mutable FTransform CachedTrackedTransform = FTransform::Identity;
+    mutable TWeakObjectPtr<const UMotionControllerComponent> CachedTrackedController;
+    mutable uint64 CachedTrackedFrame = MAX_uint64;
+    mutable bool bCachedTrackedValid = false;
+
 public:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     // Main Interface
@@ -90,6 +124,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "VR Grab")
     bool TryRelease();
 
+    // Owner going into (or out of) UFarmActorPoolSubsystem: drops any grab and takes the body
+    // out of physics sleep tracking, so an idle pooled body is never woken back into simulation
+    void SetPooled(bool bPooled);
+
     // Getters
     UFUNCTION(BlueprintPure, Category = "VR Grab")
     bool IsGrabbed() const { return bIsGrabbed; }
@@ -97,6 +135,21 @@ public:
     UFUNCTION(BlueprintPure, Category = "VR Grab")
     UMotionControllerComponent* GetGrabbingController() const { return GrabbingController; }
 
+    // Predicted pose: the controller's latest tracked pose, re-polled from the XR system.
+    // Attached objects are rendered with the late-updated pose; gameplay reads the same one here.
+    UFUNCTION(BlueprintPure, Category = "VR Grab")
+    FTransform GetPredictedControllerTransform() const;
+
+    // World transform of a component of the held object, moved with the predicted controller pose.
+    // Only attached grabs follow the hand rigidly; other grab types return the current transform.
+    UFUNCTION(BlueprintPure, Category = "VR Grab")
+    FTransform GetPredictedComponentTransform(const USceneComponent* Component) const;
+
+    static bool PollControllerTransform(const UMotionControllerComponent* Controller, FTransform& OutWorldTransform);
+
+    // Controller's latest tracked pose relative to its attach parent (VROrigin)
+    static bool PollTrackedTransform(const UMotionControllerComponent* Controller, FTransform& OutTrackedTransform);
+
 protected:
     UPrimitiveComponent* GetGrabbableComponent();
     void GrabWithAttach(UMotionControllerComponent* Controller);
@@ -105,4 +158,11 @@ protected:
     void ReleaseFromPhysicsHandle();
     void UpdatePhysicsHandle();
     UPhysicsHandleComponent* GetOrCreatePhysicsHandle();
+
+    // Async physics grab
+    void GrabWithAsyncPhysics(UMotionControllerComponent* Controller);
+    void ReleaseFromAsyncPhysics();
+    void OnControllerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+    void PushAsyncGrabTarget(bool bActive);
+    void UnregisterAsyncGrabCallback();
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "VRHandAnimationComponent.h"
+#include "MyProject/VR/Diagnostics/FarmDebugDraw.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/Skeleton.h"
 #include "Engine/World.h"
@@ -79,7 +80,14 @@ void UVRHandAnimationComponent::ConfigureHandMirroring()
 	if (UAnimInstance* LeftAnimInstance = HandLeft->GetAnimInstance())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("LEFT HAND AnimInstance found: %s"), *LeftAnimInstance->GetClass()->GetName());
-		SetAnimBPVariable(LeftAnimInstance, TEXT("bMirror"), true);
+		if (UVRHandAnimInstance* NativeInstance = Cast<UVRHandAnimInstance>(LeftAnimInstance))
+		{
+			NativeInstance->SetMirror(true);
+		}
+		else
+		{
+			SetAnimBPVariable(LeftAnimInstance, TEXT("bMirror"), true);
+		}
 		UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: LEFT HAND mirror set to TRUE"));
 	}
 	else
@@ -91,7 +99,14 @@ void UVRHandAnimationComponent::ConfigureHandMirroring()
 	if (UAnimInstance* RightAnimInstance = HandRight->GetAnimInstance())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("RIGHT HAND AnimInstance found: %s"), *RightAnimInstance->GetClass()->GetName());
-		SetAnimBPVariable(RightAnimInstance, TEXT("bMirror"), false);
+		if (UVRHandAnimInstance* NativeInstance = Cast<UVRHandAnimInstance>(RightAnimInstance))
+		{
+			NativeInstance->SetMirror(false);
+		}
+		else
+		{
+			SetAnimBPVariable(RightAnimInstance, TEXT("bMirror"), false);
+		}
 		UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: RIGHT HAND mirror set to FALSE"));
 	}
 	else
@@ -144,43 +159,57 @@ void UVRHandAnimationComponent::ForceReinitializeHands()
 	}
 }
 
-void UVRHandAnimationComponent::UpdateHandAnimation(bool bRightHand, const FString& AnimationType, float Value)
+void UVRHandAnimationComponent::SetPoseChannel(bool bRightHand, EVRHandPoseChannel Channel, float Value)
 {
-	if (!bHandsInitialized)
+	if (!bHandsInitialized || Channel == EVRHandPoseChannel::Count)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: Hands not initialized yet, skipping animation update"));
 		return;
 	}
 
-	USkeletalMeshComponent* HandMesh = bRightHand ? HandRight : HandLeft;
-	if (!HandMesh)
+	FHandAnimCache* Cache = GetHandCache(bRightHand);
+	if (!Cache)
 	{
-		UE_LOG(LogTemp, Error, TEXT("VRHandAnimationComponent: HandMesh is NULL for %s hand!"), 
-			   bRightHand ? TEXT("RIGHT") : TEXT("LEFT"));
 		return;
 	}
 
-	UAnimInstance* AnimInstance = HandMesh->GetAnimInstance();
-	if (!AnimInstance)
+	const int32 ChannelIndex = static_cast<int32>(Channel);
+	if (Cache->LastValues[ChannelIndex] == Value)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: AnimInstance is null for %s hand"), 
-			   bRightHand ? TEXT("Right") : TEXT("Left"));
 		return;
 	}
+	Cache->LastValues[ChannelIndex] = Value;
 
-	FString VariableName = GetAnimBPVariableName(AnimationType);
-	if (VariableName.IsEmpty())
+	if (Cache->NativeInstance)
+	{
+		Cache->NativeInstance->SetPoseAlpha(Channel, Value);
+	}
+	else if (FNumericProperty* Property = Cache->PoseProperties[ChannelIndex])
+	{
+		Property->SetFloatingPointPropertyValue(Property->ContainerPtrToValuePtr<void>(Cache->AnimInstance.Get()), Value);
+	}
+
+	if (OnHandAnimationChanged.IsBound())
+	{
+		OnHandAnimationChanged.Broadcast(bRightHand, GetPoseChannelName(Channel), Value);
+	}
+}
+
+void UVRHandAnimationComponent::SetAnalogPose(bool bRightHand, float GraspAlpha, float IndexCurlAlpha)
+{
+	SetPoseChannel(bRightHand, EVRHandPoseChannel::Grasp, GraspAlpha);
+	SetPoseChannel(bRightHand, EVRHandPoseChannel::IndexCurl, IndexCurlAlpha);
+}
+
+void UVRHandAnimationComponent::UpdateHandAnimation(bool bRightHand, const FString& AnimationType, float Value)
+{
+	EVRHandPoseChannel Channel;
+	if (!GetPoseChannelFromName(AnimationType, Channel))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: Unknown animation type: %s"), *AnimationType);
 		return;
 	}
 
-	SetAnimBPVariable(AnimInstance, VariableName, Value);
-	OnHandAnimationChanged.Broadcast(bRightHand, AnimationType, Value);
-
-	UE_LOG(LogTemp, Verbose, TEXT("VRHandAnimationComponent: %s hand %s animation (%s): %.2f"), 
-		   bRightHand ? TEXT("Right") : TEXT("Left"), 
-		   *AnimationType, *VariableName, Value);
+	SetPoseChannel(bRightHand, Channel, Value);
 }
 
 void UVRHandAnimationComponent::SetHandPose(bool bRightHand, const FString& PoseName, float Alpha)
@@ -190,71 +219,110 @@ void UVRHandAnimationComponent::SetHandPose(bool bRightHand, const FString& Pose
 
 void UVRHandAnimationComponent::SetThumbUpPose(bool bRightHand, float Alpha)
 {
-	UpdateHandAnimation(bRightHand, TEXT("ThumbUp"), Alpha);
+	SetPoseChannel(bRightHand, EVRHandPoseChannel::ThumbUp, Alpha);
 }
 
 void UVRHandAnimationComponent::SetPointPose(bool bRightHand, float Alpha)
 {
-	UpdateHandAnimation(bRightHand, TEXT("Point"), Alpha);
+	SetPoseChannel(bRightHand, EVRHandPoseChannel::Point, Alpha);
 }
 
 void UVRHandAnimationComponent::SetGraspPose(bool bRightHand, float Alpha)
 {
-	UpdateHandAnimation(bRightHand, TEXT("Grasp"), Alpha);
+	SetPoseChannel(bRightHand, EVRHandPoseChannel::Grasp, Alpha);
 }
 
 void UVRHandAnimationComponent::SetIndexCurl(bool bRightHand, float Alpha)
 {
-	UpdateHandAnimation(bRightHand, TEXT("IndexCurl"), Alpha);
+	SetPoseChannel(bRightHand, EVRHandPoseChannel::IndexCurl, Alpha);
 }
 
-FString UVRHandAnimationComponent::GetAnimBPVariableName(const FString& AnimationType) const
+UVRHandAnimationComponent::FHandAnimCache* UVRHandAnimationComponent::GetHandCache(bool bRightHand)
 {
-	if (AnimationType == TEXT("ThumbUp"))
-	{
-		return TEXT("PoseAlphaThumbUp");
-	}
-	else if (AnimationType == TEXT("Point"))
+	USkeletalMeshComponent* HandMesh = bRightHand ? HandRight : HandLeft;
+	UAnimInstance* AnimInstance = HandMesh ? HandMesh->GetAnimInstance() : nullptr;
+	if (!AnimInstance)
 	{
-		return TEXT("PoseAlphaPoint");
+		return nullptr;
 	}
-	else if (AnimationType == TEXT("IndexCurl"))
+
+	FHandAnimCache& Cache = bRightHand ? HandCacheRight : HandCacheLeft;
+	if (Cache.AnimInstance.Get() == AnimInstance)
 	{
-		return TEXT("PoseAlphaIndexCurl");
+		return &Cache;
 	}
-	else if (AnimationType == TEXT("Grasp"))
+
+	// Instance changed (setup or reinit): resolve once, then every update is a plain store
+	Cache = FHandAnimCache();
+	Cache.AnimInstance = AnimInstance;
+	Cache.NativeInstance = Cast<UVRHandAnimInstance>(AnimInstance);
+
+	if (!Cache.NativeInstance)
 	{
-		return TEXT("PoseAlphaGrasp");
+		for (EVRHandPoseChannel Channel : TEnumRange<EVRHandPoseChannel>())
+		{
+			const FName VariableName = GetAnimBPVariableName(Channel);
+			FNumericProperty* Property = CastField<FNumericProperty>(AnimInstance->GetClass()->FindPropertyByName(VariableName));
+
+			if (Property && Property->IsFloatingPoint())
+			{
+				Cache.PoseProperties[static_cast<int32>(Channel)] = Property;
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: Float property %s not found in AnimBP"), *VariableName.ToString());
+			}
+		}
 	}
-	
-	return FString();
+
+	return &Cache;
 }
 
-void UVRHandAnimationComponent::SetAnimBPVariable(UAnimInstance* AnimInstance, const FString& VariableName, float Value)
+bool UVRHandAnimationComponent::GetPoseChannelFromName(const FString& AnimationType, EVRHandPoseChannel& OutChannel)
 {
-	if (!AnimInstance)
-		return;
-
-	if (FProperty* Property = AnimInstance->GetClass()->FindPropertyByName(*VariableName))
+	for (EVRHandPoseChannel Channel : TEnumRange<EVRHandPoseChannel>())
 	{
-		if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
+		if (AnimationType == GetPoseChannelName(Channel))
 		{
-			FloatProp->SetPropertyValue_InContainer(AnimInstance, Value);
-			UE_LOG(LogTemp, Verbose, TEXT("Set float %s to %.2f"), *VariableName, Value);
-		}
-		else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
-		{
-			DoubleProp->SetPropertyValue_InContainer(AnimInstance, (double)Value);
-			UE_LOG(LogTemp, Verbose, TEXT("Set double %s to %.2f"), *VariableName, Value);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: Property %s found but is not a float/double"), *VariableName);
+			OutChannel = Channel;
+			return true;
 		}
 	}
-	else
+
+	return false;
+}
+
+const TCHAR* UVRHandAnimationComponent::GetPoseChannelName(EVRHandPoseChannel Channel)
+{
+	switch (Channel)
+	{
+	case EVRHandPoseChannel::ThumbUp:
+		return TEXT("ThumbUp");
+	case EVRHandPoseChannel::Point:
+		return TEXT("Point");
+	case EVRHandPoseChannel::IndexCurl:
+		return TEXT("IndexCurl");
+	case EVRHandPoseChannel::Grasp:
+		return TEXT("Grasp");
+	default:
+		return TEXT("");
+	}
+}
+
+FName UVRHandAnimationComponent::GetAnimBPVariableName(EVRHandPoseChannel Channel)
+{
+	switch (Channel)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("VRHandAnimationComponent: Property %s not found in AnimBP"), *VariableName);
+	case EVRHandPoseChannel::ThumbUp:
+		return FName(TEXT("PoseAlphaThumbUp"));
+	case EVRHandPoseChannel::Point:
+		return FName(TEXT("PoseAlphaPoint"));
+	case EVRHandPoseChannel::IndexCurl:
+		return FName(TEXT("PoseAlphaIndexCurl"));
+	case EVRHandPoseChannel::Grasp:
+		return FName(TEXT("PoseAlphaGrasp"));
+	default:
+		return NAME_None;
 	}
 }
 
@@ -268,7 +336,6 @@ void UVRHandAnimationComponent::SetAnimBPVariable(UAnimInstance* AnimInstance, c
 		if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
 		{
 			BoolProp->SetPropertyValue_InContainer(AnimInstance, Value);
-			UE_LOG(LogTemp, Warning, TEXT("Set boolean %s to %s"), *VariableName, Value ? TEXT("TRUE") : TEXT("FALSE"));
 		}
 		else
 		{
@@ -283,8 +350,9 @@ void UVRHandAnimationComponent::SetAnimBPVariable(UAnimInstance* AnimInstance, c
 
 void UVRHandAnimationComponent::DebugDrawHandBones(bool bRightHand)
 {
+#if FARM_DEBUG_DRAW_ENABLED
 	USkeletalMeshComponent* HandMesh = bRightHand ? HandRight : HandLeft;
-	if (!HandMesh || !GetWorld())
+	if (!HandMesh || !GetWorld() || !FFarmDebugDraw::IsEnabled(EFarmDebugSystem::Hands))
 		return;
 
 	USkeleton* Skeleton = HandMesh->GetSkeletalMeshAsset() ? HandMesh->GetSkeletalMeshAsset()->GetSkeleton() : nullptr;
@@ -314,7 +382,7 @@ void UVRHandAnimationComponent::DebugDrawHandBones(bool bRightHand)
 			FVector BoneLocation = HandMesh->GetBoneLocation(BoneNameFName);
 			FColor BoneColor = bRightHand ? FColor::Red : FColor::Blue;
 			
-			DrawDebugSphere(GetWorld(), BoneLocation, 0.5f, 8, BoneColor, false, -1.0f, 0, 0.1f);
+			FFarmDebugDraw::Sphere(EFarmDebugSystem::Hands, this, BoneLocation, 0.5f, 8, BoneColor, 0.0f, 0.1f);
 			DrawDebugString(GetWorld(), BoneLocation, BoneName, nullptr, BoneColor, 0.0f, true);
 		}
 	}
@@ -322,9 +390,10 @@ void UVRHandAnimationComponent::DebugDrawHandBones(bool bRightHand)
 	FVector HandLocation = HandMesh->GetComponentLocation();
 	FRotator HandRotation = HandMesh->GetComponentRotation();
 	
-	DrawDebugCoordinateSystem(GetWorld(), HandLocation, HandRotation, 5.0f, false, -1.0f, 0, 1.0f);
+	FFarmDebugDraw::Axes(EFarmDebugSystem::Hands, this, HandLocation, HandRotation, 5.0f, 0.0f, 1.0f);
 	
 	FString HandName = bRightHand ? TEXT("RIGHT HAND") : TEXT("LEFT HAND");
 	DrawDebugString(GetWorld(), HandLocation + FVector(0, 0, 10), HandName, nullptr, 
 		bRightHand ? FColor::Red : FColor::Blue, 0.0f, true);
+#endif
 }
\ No newline at end of file
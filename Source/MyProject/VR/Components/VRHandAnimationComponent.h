@@ -5,6 +5,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Engine/Engine.h"
+#include "MyProject/VR/Animation/VRHandAnimInstance.h"
 #include "VRHandAnimationComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnHandAnimationChanged, bool, bIsRightHand, FString, AnimationType, float, Value);
@@ -35,6 +36,21 @@ protected:
 	// Internal state
 	bool bHandsInitialized = false;
 
+	// Per-hand cache: native instance for plain stores, or AnimBP properties resolved once
+	struct FHandAnimCache
+	{
+		TWeakObjectPtr<UAnimInstance> AnimInstance;
+		UVRHandAnimInstance* NativeInstance = nullptr;
+		FNumericProperty* PoseProperties[static_cast<int32>(EVRHandPoseChannel::Count)] = {};
+		float LastValues[static_cast<int32>(EVRHandPoseChannel::Count)];
+
+		// Negative so the first value on each channel is always written
+		FHandAnimCache() { for (float& Value : LastValues) { Value = -1.0f; } }
+	};
+
+	FHandAnimCache HandCacheRight;
+	FHandAnimCache HandCacheLeft;
+
 public:
 	virtual void BeginPlay() override;
 
@@ -50,6 +66,14 @@ public:
 
 	// Main Animation Interface
 	UFUNCTION(BlueprintCallable, Category = "VR Hands")
+	void SetPoseChannel(bool bRightHand, EVRHandPoseChannel Channel, float Value);
+
+	// Both analog channels of one hand in a single update (used by the input filter)
+	UFUNCTION(BlueprintCallable, Category = "VR Hands")
+	void SetAnalogPose(bool bRightHand, float GraspAlpha, float IndexCurlAlpha);
+
+	// String-based entry point kept for Blueprints; maps to SetPoseChannel
+	UFUNCTION(BlueprintCallable, Category = "VR Hands")
 	void UpdateHandAnimation(bool bRightHand, const FString& AnimationType, float Value);
 
 	UFUNCTION(BlueprintCallable, Category = "VR Hands")
@@ -76,9 +100,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "VR Hands")
 	bool AreHandsInitialized() const { return bHandsInitialized; }
 
+	USkeletalMeshComponent* GetHandMesh(bool bRightHand) const { return bRightHand ? HandRight : HandLeft; }
+
 private:
 	void ConfigureHandMirroring();
-	void SetAnimBPVariable(UAnimInstance* AnimInstance, const FString& VariableName, float Value);
 	void SetAnimBPVariable(UAnimInstance* AnimInstance, const FString& VariableName, bool Value);
-	FString GetAnimBPVariableName(const FString& AnimationType) const;
+	FHandAnimCache* GetHandCache(bool bRightHand);
+	static bool GetPoseChannelFromName(const FString& AnimationType, EVRHandPoseChannel& OutChannel);
+	static const TCHAR* GetPoseChannelName(EVRHandPoseChannel Channel);
+	static FName GetAnimBPVariableName(EVRHandPoseChannel Channel);
 };
\ No newline at end of file
@@ -2,12 +2,21 @@
 #include "MyProject/VR/Components/VRTeleportComponent.h"
 #include "MyProject/VR/Components/VRInteractionComponent.h"
 #include "MyProject/VR/Components/VRHandAnimationComponent.h"
+#include "MyProject/VR/Components/VRPerfPanelComponent.h"
 #include "MyProject/VR/Pawns/VRPawn.h"
 #include "MotionControllerComponent.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "GameFramework/Controller.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hand Input Filter"), STAT_FarmHandInputFilter, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hand Input Events In"), STAT_FarmHandInputEventsIn, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hand Input Events Forwarded"), STAT_FarmHandInputEventsForwarded, STATGROUP_HarvestHaven);
 
 UVRInputComponent::UVRInputComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// Ticks only while analog hand values are pending or settling
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UVRInputComponent::Initialize(UVRTeleportComponent* TeleportComp, UVRInteractionComponent* InteractionComp, 
@@ -17,12 +26,33 @@ void UVRInputComponent::Initialize(UVRTeleportComponent* TeleportComp, UVRIntera
 	InteractionComponent = InteractionComp;
 	HandAnimationComponent = HandAnimComp;
 	OwnerPawn = Pawn;
+
+	// Forward before the hands evaluate their anim graph this frame
+	if (HandAnimationComponent)
+	{
+		for (bool bRightHand : { true, false })
+		{
+			if (USkeletalMeshComponent* HandMesh = HandAnimationComponent->GetHandMesh(bRightHand))
+			{
+				HandMesh->PrimaryComponentTick.AddPrerequisite(this, PrimaryComponentTick);
+			}
+		}
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("VRInputComponent: Initialized with all component references"));
 }
 
 void UVRInputComponent::SetupInputBindings(UInputComponent* PlayerInputComponent)
 {
+	// Input is processed in the controller tick; filter after it in the same frame
+	if (const APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		if (AController* Controller = Pawn->GetController())
+		{
+			AddTickPrerequisiteActor(Controller);
+		}
+	}
+
 	if (UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent))
 	{
 		// Teleport and movement
@@ -58,11 +88,13 @@ void UVRInputComponent::SetupInputBindings(UInputComponent* PlayerInputComponent
 		if (IA_Hand_Grasp_Right)
 		{
 			EnhancedInputComponent->BindAction(IA_Hand_Grasp_Right, ETriggerEvent::Triggered, this, &UVRInputComponent::OnHandGraspRight);
+			EnhancedInputComponent->BindAction(IA_Hand_Grasp_Right, ETriggerEvent::Completed, this, &UVRInputComponent::OnHandGraspRight);
 		}
 
 		if (IA_Hand_Grasp_Left)
 		{
 			EnhancedInputComponent->BindAction(IA_Hand_Grasp_Left, ETriggerEvent::Triggered, this, &UVRInputComponent::OnHandGraspLeft);
+			EnhancedInputComponent->BindAction(IA_Hand_Grasp_Left, ETriggerEvent::Completed, this, &UVRInputComponent::OnHandGraspLeft);
 		}
 
 		// Menu actions
@@ -104,11 +136,13 @@ void UVRInputComponent::SetupInputBindings(UInputComponent* PlayerInputComponent
 		if (IA_Hand_IndexCurl_Right)
 		{
 			EnhancedInputComponent->BindAction(IA_Hand_IndexCurl_Right, ETriggerEvent::Triggered, this, &UVRInputComponent::OnHandIndexCurlRight);
+			EnhancedInputComponent->BindAction(IA_Hand_IndexCurl_Right, ETriggerEvent::Completed, this, &UVRInputComponent::OnHandIndexCurlRight);
 		}
 
 		if (IA_Hand_IndexCurl_Left)
 		{
 			EnhancedInputComponent->BindAction(IA_Hand_IndexCurl_Left, ETriggerEvent::Triggered, this, &UVRInputComponent::OnHandIndexCurlLeft);
+			EnhancedInputComponent->BindAction(IA_Hand_IndexCurl_Left, ETriggerEvent::Completed, this, &UVRInputComponent::OnHandIndexCurlLeft);
 		}
 
 		UE_LOG(LogTemp, Log, TEXT("VRInputComponent: Input bindings setup complete"));
@@ -125,6 +159,8 @@ void UVRInputComponent::SetupInputBindings(UInputComponent* PlayerInputComponent
 
 void UVRInputComponent::OnMoveStarted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::MoveStarted, Value);
+
 	if (!OwnerPawn)
 	{
 		return;
@@ -152,6 +188,8 @@ void UVRInputComponent::OnMoveStarted(const FInputActionValue& Value)
 
 void UVRInputComponent::OnMoveTriggered(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::MoveTriggered, Value);
+
 	if (!OwnerPawn)
 	{
 		return;
@@ -183,6 +221,8 @@ void UVRInputComponent::OnMoveTriggered(const FInputActionValue& Value)
 
 void UVRInputComponent::OnMoveCompleted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::MoveCompleted, Value);
+
 	if (!OwnerPawn)
 	{
 		return;
@@ -213,6 +253,8 @@ void UVRInputComponent::OnMoveCompleted(const FInputActionValue& Value)
 
 void UVRInputComponent::OnGrabLeftPressed(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::GrabLeftPressed, Value);
+
 	if (InteractionComponent)
 	{
 		InteractionComponent->TryGrabWithLeftHand();
@@ -221,6 +263,8 @@ void UVRInputComponent::OnGrabLeftPressed(const FInputActionValue& Value)
 
 void UVRInputComponent::OnGrabLeftReleased(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::GrabLeftReleased, Value);
+
 	if (InteractionComponent)
 	{
 		InteractionComponent->TryReleaseLeftHand();
@@ -229,6 +273,8 @@ void UVRInputComponent::OnGrabLeftReleased(const FInputActionValue& Value)
 
 void UVRInputComponent::OnGrabRightPressed(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::GrabRightPressed, Value);
+
 	if (InteractionComponent)
 	{
 		InteractionComponent->TryGrabWithRightHand();
@@ -237,6 +283,8 @@ void UVRInputComponent::OnGrabRightPressed(const FInputActionValue& Value)
 
 void UVRInputComponent::OnGrabRightReleased(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::GrabRightReleased, Value);
+
 	if (InteractionComponent)
 	{
 		InteractionComponent->TryReleaseRightHand();
@@ -245,20 +293,16 @@ void UVRInputComponent::OnGrabRightReleased(const FInputActionValue& Value)
 
 void UVRInputComponent::OnHandGraspRight(const FInputActionValue& Value)
 {
-	if (HandAnimationComponent)
-	{
-		const float GraspValue = Value.Get<float>();
-		HandAnimationComponent->SetGraspPose(true, GraspValue);
-	}
+	OnInputAction.Broadcast(EVRInputActionId::HandGraspRight, Value);
+
+	QueueAnalogValue(EVRAnalogHandChannel::GraspRight, Value.Get<float>());
 }
 
 void UVRInputComponent::OnHandGraspLeft(const FInputActionValue& Value)
 {
-	if (HandAnimationComponent)
-	{
-		const float GraspValue = Value.Get<float>();
-		HandAnimationComponent->SetGraspPose(false, GraspValue);
-	}
+	OnInputAction.Broadcast(EVRInputActionId::HandGraspLeft, Value);
+
+	QueueAnalogValue(EVRAnalogHandChannel::GraspLeft, Value.Get<float>());
 }
 
 // ============================================================
@@ -267,11 +311,18 @@ void UVRInputComponent::OnHandGraspLeft(const FInputActionValue& Value)
 
 void UVRInputComponent::OnMenuToggleLeft(const FInputActionValue& Value)
 {
-	UE_LOG(LogTemp, Log, TEXT("VRInputComponent: Left menu toggle pressed"));
+	OnInputAction.Broadcast(EVRInputActionId::MenuToggleLeft, Value);
+
+	if (UVRPerfPanelComponent* PerfPanel = GetOwner() ? GetOwner()->FindComponentByClass<UVRPerfPanelComponent>() : nullptr)
+	{
+		PerfPanel->TogglePanel();
+	}
 }
 
 void UVRInputComponent::OnMenuToggleRight(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::MenuToggleRight, Value);
+
 	UE_LOG(LogTemp, Log, TEXT("VRInputComponent: Right menu toggle pressed"));
 }
 
@@ -281,6 +332,8 @@ void UVRInputComponent::OnMenuToggleRight(const FInputActionValue& Value)
 
 void UVRInputComponent::OnHandThumbUpRightStarted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandThumbUpRightStarted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetThumbUpPose(true, 0.0f);
@@ -290,6 +343,8 @@ void UVRInputComponent::OnHandThumbUpRightStarted(const FInputActionValue& Value
 
 void UVRInputComponent::OnHandThumbUpRightCompleted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandThumbUpRightCompleted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetThumbUpPose(true, 1.0f);
@@ -299,6 +354,8 @@ void UVRInputComponent::OnHandThumbUpRightCompleted(const FInputActionValue& Val
 
 void UVRInputComponent::OnHandThumbUpLeftStarted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandThumbUpLeftStarted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetThumbUpPose(false, 0.0f);
@@ -308,6 +365,8 @@ void UVRInputComponent::OnHandThumbUpLeftStarted(const FInputActionValue& Value)
 
 void UVRInputComponent::OnHandThumbUpLeftCompleted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandThumbUpLeftCompleted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetThumbUpPose(false, 1.0f);
@@ -317,6 +376,8 @@ void UVRInputComponent::OnHandThumbUpLeftCompleted(const FInputActionValue& Valu
 
 void UVRInputComponent::OnHandPointRightStarted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandPointRightStarted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetPointPose(true, 1.0f);
@@ -326,6 +387,8 @@ void UVRInputComponent::OnHandPointRightStarted(const FInputActionValue& Value)
 
 void UVRInputComponent::OnHandPointRightCompleted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandPointRightCompleted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetPointPose(true, 0.0f);
@@ -335,6 +398,8 @@ void UVRInputComponent::OnHandPointRightCompleted(const FInputActionValue& Value
 
 void UVRInputComponent::OnHandPointLeftStarted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandPointLeftStarted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetPointPose(false, 1.0f);
@@ -344,6 +409,8 @@ void UVRInputComponent::OnHandPointLeftStarted(const FInputActionValue& Value)
 
 void UVRInputComponent::OnHandPointLeftCompleted(const FInputActionValue& Value)
 {
+	OnInputAction.Broadcast(EVRInputActionId::HandPointLeftCompleted, Value);
+
 	if (HandAnimationComponent)
 	{
 		HandAnimationComponent->SetPointPose(false, 0.0f);
@@ -353,18 +420,187 @@ void UVRInputComponent::OnHandPointLeftCompleted(const FInputActionValue& Value)
 
 void UVRInputComponent::OnHandIndexCurlRight(const FInputActionValue& Value)
 {
-	if (HandAnimationComponent)
+	OnInputAction.Broadcast(EVRInputActionId::HandIndexCurlRight, Value);
+
+	QueueAnalogValue(EVRAnalogHandChannel::IndexCurlRight, Value.Get<float>());
+}
+
+void UVRInputComponent::OnHandIndexCurlLeft(const FInputActionValue& Value)
+{
+	OnInputAction.Broadcast(EVRInputActionId::HandIndexCurlLeft, Value);
+
+	QueueAnalogValue(EVRAnalogHandChannel::IndexCurlLeft, Value.Get<float>());
+}
+
+// ============================================================
+// ANALOG INPUT FILTER
+// ============================================================
+
+void UVRInputComponent::QueueAnalogValue(EVRAnalogHandChannel Channel, float Value)
+{
+	++AnalogEventsIn;
+	INC_DWORD_STAT(STAT_FarmHandInputEventsIn);
+
+	// Several events in one frame collapse into the last value
+	FAnalogChannelFilter& Filter = AnalogChannels[static_cast<int32>(Channel)];
+	Filter.RawValue = FMath::Clamp(Value, 0.0f, 1.0f);
+	Filter.bDirty = true;
+
+	if (!IsComponentTickEnabled())
 	{
-		const float CurlValue = Value.Get<float>();
-		HandAnimationComponent->SetIndexCurl(true, CurlValue);
+		SetComponentTickEnabled(true);
 	}
 }
 
-void UVRInputComponent::OnHandIndexCurlLeft(const FInputActionValue& Value)
+bool UVRInputComponent::FilterAnalogChannel(FAnalogChannelFilter& Filter, float DeltaTime, bool& bOutStillSettling) const
 {
-	if (HandAnimationComponent)
+	if (AnalogSmoothingSpeed > 0.0f)
+	{
+		const float Alpha = 1.0f - FMath::Exp(-AnalogSmoothingSpeed * DeltaTime);
+		Filter.SmoothedValue = FMath::Lerp(Filter.SmoothedValue, Filter.RawValue, Alpha);
+	}
+	else
+	{
+		Filter.SmoothedValue = Filter.RawValue;
+	}
+
+	// Snap when close so the smoothing settles and the tick can switch off
+	if (FMath::Abs(Filter.SmoothedValue - Filter.RawValue) < AnalogDeadBand * 0.5f)
+	{
+		Filter.SmoothedValue = Filter.RawValue;
+	}
+
+	bOutStillSettling = Filter.SmoothedValue != Filter.RawValue;
+	Filter.bDirty = bOutStillSettling;
+
+	// Fully open/closed always goes through so the pose reaches its end
+	const bool bReachedEnd = (Filter.SmoothedValue == 0.0f || Filter.SmoothedValue == 1.0f) && Filter.ForwardedValue != Filter.SmoothedValue;
+	if (!bReachedEnd && FMath::Abs(Filter.SmoothedValue - Filter.ForwardedValue) < AnalogDeadBand)
+	{
+		return false;
+	}
+
+	Filter.ForwardedValue = Filter.SmoothedValue;
+	return true;
+}
+
+void UVRInputComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmHandInputFilter);
+
+	bool bAnySettling = false;
+
+	for (bool bRightHand : { true, false })
+	{
+		FAnalogChannelFilter& Grasp = AnalogChannels[static_cast<int32>(bRightHand ? EVRAnalogHandChannel::GraspRight : EVRAnalogHandChannel::GraspLeft)];
+		FAnalogChannelFilter& IndexCurl = AnalogChannels[static_cast<int32>(bRightHand ? EVRAnalogHandChannel::IndexCurlRight : EVRAnalogHandChannel::IndexCurlLeft)];
+
+		bool bChanged = false;
+		bool bSettling = false;
+
+		if (Grasp.bDirty)
+		{
+			bChanged |= FilterAnalogChannel(Grasp, DeltaTime, bSettling);
+			bAnySettling |= bSettling;
+		}
+
+		if (IndexCurl.bDirty)
+		{
+			bChanged |= FilterAnalogChannel(IndexCurl, DeltaTime, bSettling);
+			bAnySettling |= bSettling;
+		}
+
+		// One hand-pose update per hand per frame
+		if (bChanged && HandAnimationComponent)
+		{
+			HandAnimationComponent->SetAnalogPose(bRightHand, Grasp.ForwardedValue, IndexCurl.ForwardedValue);
+			++AnalogEventsForwarded;
+			INC_DWORD_STAT(STAT_FarmHandInputEventsForwarded);
+		}
+	}
+
+	if (!bAnySettling)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UVRInputComponent::ResetAnalogCounters()
+{
+	AnalogEventsIn = 0;
+	AnalogEventsForwarded = 0;
+}
+
+void UVRInputComponent::ReplayAction(EVRInputActionId ActionId, const FInputActionValue& Value)
+{
+	switch (ActionId)
 	{
-		const float CurlValue = Value.Get<float>();
-		HandAnimationComponent->SetIndexCurl(false, CurlValue);
+	case EVRInputActionId::MoveStarted:
+		OnMoveStarted(Value);
+		break;
+	case EVRInputActionId::MoveTriggered:
+		OnMoveTriggered(Value);
+		break;
+	case EVRInputActionId::MoveCompleted:
+		OnMoveCompleted(Value);
+		break;
+	case EVRInputActionId::GrabLeftPressed:
+		OnGrabLeftPressed(Value);
+		break;
+	case EVRInputActionId::GrabLeftReleased:
+		OnGrabLeftReleased(Value);
+		break;
+	case EVRInputActionId::GrabRightPressed:
+		OnGrabRightPressed(Value);
+		break;
+	case EVRInputActionId::GrabRightReleased:
+		OnGrabRightReleased(Value);
+		break;
+	case EVRInputActionId::HandGraspRight:
+		OnHandGraspRight(Value);
+		break;
+	case EVRInputActionId::HandGraspLeft:
+		OnHandGraspLeft(Value);
+		break;
+	case EVRInputActionId::MenuToggleLeft:
+		OnMenuToggleLeft(Value);
+		break;
+	case EVRInputActionId::MenuToggleRight:
+		OnMenuToggleRight(Value);
+		break;
+	case EVRInputActionId::HandThumbUpRightStarted:
+		OnHandThumbUpRightStarted(Value);
+		break;
+	case EVRInputActionId::HandThumbUpRightCompleted:
+		OnHandThumbUpRightCompleted(Value);
+		break;
+	case EVRInputActionId::HandThumbUpLeftStarted:
+		OnHandThumbUpLeftStarted(Value);
+		break;
+	case EVRInputActionId::HandThumbUpLeftCompleted:
+		OnHandThumbUpLeftCompleted(Value);
+		break;
+	case EVRInputActionId::HandPointRightStarted:
+		OnHandPointRightStarted(Value);
+		break;
+	case EVRInputActionId::HandPointRightCompleted:
+		OnHandPointRightCompleted(Value);
+		break;
+	case EVRInputActionId::HandPointLeftStarted:
+		OnHandPointLeftStarted(Value);
+		break;
+	case EVRInputActionId::HandPointLeftCompleted:
+		OnHandPointLeftCompleted(Value);
+		break;
+	case EVRInputActionId::HandIndexCurlRight:
+		OnHandIndexCurlRight(Value);
+		break;
+	case EVRInputActionId::HandIndexCurlLeft:
+		OnHandIndexCurlLeft(Value);
+		break;
+	default:
+		break;
 	}
 }
\ No newline at end of file
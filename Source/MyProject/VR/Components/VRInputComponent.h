@@ -13,6 +13,47 @@ class UVRHandAnimationComponent;
 class AVRPawn;
 class UMotionControllerComponent;
 
+// Analog hand channels that go through the input filter stage
+UENUM(BlueprintType)
+enum class EVRAnalogHandChannel : uint8
+{
+	GraspRight,
+	GraspLeft,
+	IndexCurlRight,
+	IndexCurlLeft,
+	Count UMETA(Hidden)
+};
+
+// Every input handler, so actions can be recorded and replayed by id
+UENUM()
+enum class EVRInputActionId : uint8
+{
+	MoveStarted,
+	MoveTriggered,
+	MoveCompleted,
+	GrabLeftPressed,
+	GrabLeftReleased,
+	GrabRightPressed,
+	GrabRightReleased,
+	HandGraspRight,
+	HandGraspLeft,
+	MenuToggleLeft,
+	MenuToggleRight,
+	HandThumbUpRightStarted,
+	HandThumbUpRightCompleted,
+	HandThumbUpLeftStarted,
+	HandThumbUpLeftCompleted,
+	HandPointRightStarted,
+	HandPointRightCompleted,
+	HandPointLeftStarted,
+	HandPointLeftCompleted,
+	HandIndexCurlRight,
+	HandIndexCurlLeft,
+	Count UMETA(Hidden)
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVRInputAction, EVRInputActionId /*ActionId*/, const FInputActionValue& /*Value*/);
+
 UCLASS(BlueprintType, Blueprintable, ClassGroup=(VR), meta=(BlueprintSpawnableComponent))
 class MYPROJECT_API UVRInputComponent : public UActorComponent
 {
@@ -21,6 +62,9 @@ class MYPROJECT_API UVRInputComponent : public UActorComponent
 public:
 	UVRInputComponent();
 
+	// Fired by every input handler before it acts (session recorder)
+	FOnVRInputAction OnInputAction;
+
 protected:
 	// ============================================================
 	// INPUT ACTIONS
@@ -74,6 +118,32 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VR Input Actions")
 	UInputAction* IA_Hand_IndexCurl_Left;
 
+	// ============================================================
+	// ANALOG INPUT FILTER
+	// ============================================================
+
+	// Changes smaller than this (after smoothing) are not forwarded to the hands
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Input Filter", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float AnalogDeadBand = 0.02f;
+
+	// Exponential smoothing speed (1/s); 0 forwards the latest value directly
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Input Filter", meta = (ClampMin = "0.0"))
+	float AnalogSmoothingSpeed = 30.0f;
+
+	struct FAnalogChannelFilter
+	{
+		float RawValue = 0.0f;
+		float SmoothedValue = 0.0f;
+		float ForwardedValue = 0.0f;
+		bool bDirty = false;
+	};
+
+	FAnalogChannelFilter AnalogChannels[static_cast<int32>(EVRAnalogHandChannel::Count)];
+
+	// Counters: raw Enhanced Input events received vs hand updates forwarded
+	int32 AnalogEventsIn = 0;
+	int32 AnalogEventsForwarded = 0;
+
 	// ============================================================
 	// COMPONENT REFERENCES
 	// ============================================================
@@ -102,6 +172,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "VR Input")
 	void SetupInputBindings(UInputComponent* PlayerInputComponent);
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Analog filter counters
+	UFUNCTION(BlueprintPure, Category = "VR Input")
+	int32 GetAnalogEventsIn() const { return AnalogEventsIn; }
+
+	UFUNCTION(BlueprintPure, Category = "VR Input")
+	int32 GetAnalogEventsForwarded() const { return AnalogEventsForwarded; }
+
+	UFUNCTION(BlueprintCallable, Category = "VR Input")
+	void ResetAnalogCounters();
+
+	// Run the handler for a recorded action as if Enhanced Input had fired it
+	void ReplayAction(EVRInputActionId ActionId, const FInputActionValue& Value);
+
 	// ============================================================
 	// INPUT EVENT HANDLERS
 	// ============================================================
@@ -168,4 +253,9 @@ public:
 
 	UFUNCTION()
 	void OnHandIndexCurlLeft(const FInputActionValue& Value);
+
+private:
+	// Store the latest value of the frame; the tick filters and forwards it once
+	void QueueAnalogValue(EVRAnalogHandChannel Channel, float Value);
+	bool FilterAnalogChannel(FAnalogChannelFilter& Filter, float DeltaTime, bool& bOutStillSettling) const;
 };
\ No newline at end of file
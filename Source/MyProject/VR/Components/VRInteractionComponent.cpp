@@ -1,6 +1,13 @@
 #include "VRInteractionComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmPhysicsSleepSubsystem.h"
+#include "MyProject/VR/Actors/SeedPileActor.h"
+#include "MyProject/VR/Actors/SeedItem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Grab Query"), STAT_FarmGrabQuery, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Grab Dispatch"), STAT_FarmGrabDispatch, STATGROUP_HarvestHaven);
 
 UVRInteractionComponent::UVRInteractionComponent()
 {
@@ -11,6 +18,13 @@ void UVRInteractionComponent::SetMotionControllers(UMotionControllerComponent* R
 {
 	MotionControllerRightGrip = RightGrip;
 	MotionControllerLeftGrip = LeftGrip;
+
+	// Hands hovering near a demoted grabbable put it back into the simulation
+	if (UFarmPhysicsSleepSubsystem* SleepSubsystem = UFarmPhysicsSleepSubsystem::Get(this))
+	{
+		SleepSubsystem->RegisterWakeSource(RightGrip);
+		SleepSubsystem->RegisterWakeSource(LeftGrip);
+	}
 	UE_LOG(LogTemp, Log, TEXT("VRInteractionComponent: Motion controllers set"));
 }
 
@@ -105,18 +119,21 @@ UActorComponent* UVRInteractionComponent::GetGrabComponentNearMotionController(U
 		return nullptr;
 	}
 
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmGrabQuery);
+	FARM_COUNTER_INC(SceneQueries);
+
 	const FVector ControllerLocation = MotionController->GetComponentLocation();
 
 	TArray<FOverlapResult> OverlapResults;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(GetOwner());
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(VRGrabOverlap), false, GetOwner());
 
 	bool bHasOverlaps = GetWorld()->OverlapMultiByObjectType(
 		OverlapResults,
 		ControllerLocation,
 		FQuat::Identity,
 		FCollisionObjectQueryParams(ECC_PhysicsBody),
-		FCollisionShape::MakeSphere(GrabRadiusFromGripPosition)
+		FCollisionShape::MakeSphere(GrabRadiusFromGripPosition),
+		QueryParams
 	);
 
 	if (bHasOverlaps)
@@ -125,7 +142,15 @@ UActorComponent* UVRInteractionComponent::GetGrabComponentNearMotionController(U
 		// Si está en el overlap, está dentro del radio - no necesitamos más validación
 		for (const FOverlapResult& Result : OverlapResults)
 		{
-			if (AActor* OverlappedActor = Result.GetActor())
+			AActor* OverlappedActor = Result.GetActor();
+
+			// Seed piles are instances; promote the touched one to a real seed and grab that
+			if (ASeedPileActor* SeedPile = Cast<ASeedPileActor>(OverlappedActor))
+			{
+				OverlappedActor = SeedPile->PromoteInstance(Result.ItemIndex);
+			}
+
+			if (OverlappedActor)
 			{
 				TArray<UActorComponent*> GrabComponents = OverlappedActor->GetComponentsByTag(
 					UActorComponent::StaticClass(), 
@@ -152,6 +177,8 @@ bool UVRInteractionComponent::TryGrabComponent(UActorComponent* GrabComponent, U
 		return false;
 	}
 
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmGrabDispatch);
+
 	if (UFunction* TryGrabFunction = GrabComponent->GetClass()->FindFunctionByName(FName("TryGrab")))
 	{
 		struct FTryGrabParams
@@ -178,6 +205,8 @@ bool UVRInteractionComponent::TryReleaseComponent(UActorComponent* GrabComponent
 		return false;
 	}
 
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmGrabDispatch);
+
 	if (UFunction* TryReleaseFunction = GrabComponent->GetClass()->FindFunctionByName(FName("TryRelease")))
 	{
 		struct FTryReleaseParams
@@ -0,0 +1,137 @@
+#include "VRPerfPanelComponent.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmFrameBudgetSubsystem.h"
+#include "MyProject/VR/Subsystems/FarmPhysicsSleepSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "RenderCore.h"
+#include "RHI.h"
+
+UVRPerfPanelComponent::UVRPerfPanelComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetGenerateOverlapEvents(false);
+	CastShadow = false;
+	bHiddenInGame = true;
+
+	WorldSize = 1.2f;
+	HorizontalAlignment = EHTA_Left;
+	VerticalAlignment = EVRTA_TextBottom;
+	TextRenderColor = FColor::White;
+}
+
+void UVRPerfPanelComponent::TogglePanel()
+{
+	SetPanelVisible(!bPanelVisible);
+}
+
+void UVRPerfPanelComponent::SetPanelVisible(bool bVisible)
+{
+	bPanelVisible = bVisible;
+	SetHiddenInGame(!bVisible);
+	SetComponentTickEnabled(bVisible);
+
+	if (bVisible)
+	{
+		ResetWindow();
+		SetText(FText::FromString(TEXT("Perf: collecting...")));
+	}
+}
+
+void UVRPerfPanelComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Per frame: a few adds, nothing else
+	const float GameMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	const float RenderMs = static_cast<float>(FPlatformTime::ToMilliseconds(GRenderThreadTime));
+	const float GpuMs = static_cast<float>(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles()));
+
+	++WindowFrames;
+	GameMsSum += GameMs;
+	RenderMsSum += RenderMs;
+	GpuMsSum += GpuMs;
+	GameMsMax = FMath::Max(GameMsMax, GameMs);
+	RenderMsMax = FMath::Max(RenderMsMax, RenderMs);
+	GpuMsMax = FMath::Max(GpuMsMax, GpuMs);
+
+	TimeSinceRefresh += DeltaTime;
+	if (TimeSinceRefresh >= 1.0f / RefreshRate)
+	{
+		BuildSnapshot();
+		UpdatePanelText();
+		ResetWindow();
+	}
+}
+
+void UVRPerfPanelComponent::ResetWindow()
+{
+	TimeSinceRefresh = 0.0f;
+	WindowFrames = 0;
+	GameMsSum = RenderMsSum = GpuMsSum = 0.0;
+	GameMsMax = RenderMsMax = GpuMsMax = 0.0f;
+
+	WindowStartSceneQueries = FFarmCounters::Get(EFarmCounter::SceneQueries);
+	WindowStartActorScans = FFarmCounters::Get(EFarmCounter::ActorScans);
+
+	const UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this);
+	WindowStartOverrunFrames = FrameBudget ? FrameBudget->GetOverrunFrameCount() : 0;
+}
+
+void UVRPerfPanelComponent::BuildSnapshot()
+{
+	FFarmPerfSnapshot& Snapshot = LastSnapshot;
+	const double Frames = FMath::Max(WindowFrames, 1);
+
+	Snapshot.Frames = WindowFrames;
+	Snapshot.GameMs = static_cast<float>(GameMsSum / Frames);
+	Snapshot.RenderMs = static_cast<float>(RenderMsSum / Frames);
+	Snapshot.GpuMs = static_cast<float>(GpuMsSum / Frames);
+	Snapshot.MaxGameMs = GameMsMax;
+	Snapshot.MaxRenderMs = RenderMsMax;
+	Snapshot.MaxGpuMs = GpuMsMax;
+
+	Snapshot.Crops[0] = FFarmCounters::Get(EFarmCounter::CropsSeed);
+	Snapshot.Crops[1] = FFarmCounters::Get(EFarmCounter::CropsGrowing);
+	Snapshot.Crops[2] = FFarmCounters::Get(EFarmCounter::CropsMature);
+	Snapshot.Crops[3] = FFarmCounters::Get(EFarmCounter::CropsDry);
+	Snapshot.GrabbablesHeld = FFarmCounters::Get(EFarmCounter::GrabbablesHeld);
+
+	Snapshot.SceneQueries = static_cast<float>((FFarmCounters::Get(EFarmCounter::SceneQueries) - WindowStartSceneQueries) / Frames);
+	Snapshot.ActorScans = static_cast<float>((FFarmCounters::Get(EFarmCounter::ActorScans) - WindowStartActorScans) / Frames);
+
+	const UFarmPhysicsSleepSubsystem* PhysicsSleep = UFarmPhysicsSleepSubsystem::Get(this);
+	Snapshot.SimulatedBodies = PhysicsSleep ? PhysicsSleep->GetSimulatedBodyCount() : 0;
+	Snapshot.AwakeBodies = PhysicsSleep ? PhysicsSleep->GetAwakeBodyCount() : 0;
+
+	const UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this);
+	Snapshot.BudgetOverrunFrames = FrameBudget ? FrameBudget->GetOverrunFrameCount() - WindowStartOverrunFrames : 0;
+	Snapshot.DeferredWork = FrameBudget ? FrameBudget->GetDeferredCount() : 0;
+}
+
+void UVRPerfPanelComponent::UpdatePanelText()
+{
+	const FFarmPerfSnapshot& Snapshot = LastSnapshot;
+
+	const FString Text = FString::Printf(
+		TEXT("Game   %5.1f ms (max %5.1f)\n")
+		TEXT("Render %5.1f ms (max %5.1f)\n")
+		TEXT("GPU    %5.1f ms (max %5.1f)\n")
+		TEXT("Crops  %lld seed / %lld growing / %lld mature / %lld dry\n")
+		TEXT("Bodies %d simulated / %d awake / %lld held\n")
+		TEXT("Per frame  %.1f queries / %.1f scans\n")
+		TEXT("Budget overruns %d of %d frames, %d deferred"),
+		Snapshot.GameMs, Snapshot.MaxGameMs,
+		Snapshot.RenderMs, Snapshot.MaxRenderMs,
+		Snapshot.GpuMs, Snapshot.MaxGpuMs,
+		Snapshot.Crops[0], Snapshot.Crops[1], Snapshot.Crops[2], Snapshot.Crops[3],
+		Snapshot.SimulatedBodies, Snapshot.AwakeBodies, Snapshot.GrabbablesHeld,
+		Snapshot.SceneQueries, Snapshot.ActorScans,
+		Snapshot.BudgetOverrunFrames, Snapshot.Frames, Snapshot.DeferredWork);
+
+	const float WorstMs = FMath::Max3(Snapshot.MaxGameMs, Snapshot.MaxRenderMs, Snapshot.MaxGpuMs);
+	SetTextRenderColor(WorstMs > TargetFrameMs ? FColor::Red : FColor::White);
+	SetText(FText::FromString(Text));
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/TextRenderComponent.h"
+#include "VRPerfPanelComponent.generated.h"
+
+/** Numbers shown by the panel, aggregated over one refresh window. */
+struct FFarmPerfSnapshot
+{
+	int32 Frames = 0;
+
+	// Milliseconds, average and worst frame of the window
+	float GameMs = 0.0f;
+	float RenderMs = 0.0f;
+	float GpuMs = 0.0f;
+	float MaxGameMs = 0.0f;
+	float MaxRenderMs = 0.0f;
+	float MaxGpuMs = 0.0f;
+
+	int64 Crops[4] = {};
+	int64 GrabbablesHeld = 0;
+	int32 SimulatedBodies = 0;
+	int32 AwakeBodies = 0;
+
+	// Per frame, averaged over the window
+	float SceneQueries = 0.0f;
+	float ActorScans = 0.0f;
+
+	int32 BudgetOverrunFrames = 0;
+	int32 DeferredWork = 0;
+};
+
+/**
+ * World-space performance panel for testers, toggled with IA_Menu_Toggle_Left.
+ *
+ * While visible it only adds a few numbers per frame; the text is rebuilt at RefreshRate from
+ * the aggregated window, so the panel does not show up in the frame times it reports.
+ * Attach it to the left grip controller (AVRPawn does) so it can be read on the wrist.
+ */
+UCLASS(ClassGroup=(VR), meta=(BlueprintSpawnableComponent))
+class MYPROJECT_API UVRPerfPanelComponent : public UTextRenderComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVRPerfPanelComponent();
+
+	// Text rebuilds per second
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Perf Panel", meta = (ClampMin = "0.5", ClampMax = "30.0"))
+	float RefreshRate = 4.0f;
+
+	// The panel turns red when the worst frame of a window is over this (ms, 13.9 = 72 Hz)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Perf Panel")
+	float TargetFrameMs = 13.9f;
+
+	UFUNCTION(BlueprintCallable, Category = "VR Perf Panel")
+	void TogglePanel();
+
+	UFUNCTION(BlueprintCallable, Category = "VR Perf Panel")
+	void SetPanelVisible(bool bVisible);
+
+	UFUNCTION(BlueprintPure, Category = "VR Perf Panel")
+	bool IsPanelVisible() const { return bPanelVisible; }
+
+	const FFarmPerfSnapshot& GetLastSnapshot() const { return LastSnapshot; }
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	void ResetWindow();
+	void BuildSnapshot();
+	void UpdatePanelText();
+
+	bool bPanelVisible = false;
+	float TimeSinceRefresh = 0.0f;
+
+	// Current window
+	int32 WindowFrames = 0;
+	double GameMsSum = 0.0;
+	double RenderMsSum = 0.0;
+	double GpuMsSum = 0.0;
+	float GameMsMax = 0.0f;
+	float RenderMsMax = 0.0f;
+	float GpuMsMax = 0.0f;
+
+	// Running totals at the start of the window
+	int64 WindowStartSceneQueries = 0;
+	int64 WindowStartActorScans = 0;
+	int32 WindowStartOverrunFrames = 0;
+
+	FFarmPerfSnapshot LastSnapshot;
+};
\ No newline at end of file
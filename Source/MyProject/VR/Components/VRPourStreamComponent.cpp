@@ -0,0 +1,357 @@
+#include "VRPourStreamComponent.h"
+#include "Engine/World.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pour Stream Simulate"), STAT_FarmPourStreamSimulate, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Pour Stream Heightfield"), STAT_FarmPourStreamHeightfield, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pour Stream Particles"), STAT_FarmPourStreamParticles, STATGROUP_HarvestHaven);
+
+namespace VRPourStream
+{
+	// UserData de cada traza: lote en los 16 bits altos, celda (< 64*64) en los bajos
+	static constexpr uint32 BatchShift = 16;
+	static constexpr uint32 CellMask = 0xFFFF;
+}
+
+UVRPourStreamComponent::UVRPourStreamComponent()
+{
+	// Sólo tickea mientras sale agua o queda agua en el aire
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	Random.GenerateNewSeed();
+}
+
+void UVRPourStreamComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DEC_DWORD_STAT_BY(STAT_FarmPourStreamParticles, NumParticles);
+	NumParticles = 0;
+	PendingImpacts.Reset();
+
+	// Las trazas que sigan en vuelo se ignoran al volver
+	++HeightfieldBatch;
+	PendingTraces = 0;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UVRPourStreamComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	Simulate(DeltaTime);
+
+	if (!IsEmitting() && NumParticles == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+// ============================================================
+// EMITTER
+// ============================================================
+
+void UVRPourStreamComponent::SetEmitter(const FVector& Location, const FVector& Direction, float Flow)
+{
+	EmitterLocation = Location;
+	EmitterDirection = Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+	EmitterFlow = FMath::Clamp(Flow, 0.0f, 1.0f);
+
+	// Capacidad fija, múltiplo de 4: el SIMD puede leer el último grupo completo
+	const int32 Capacity = Align(FMath::Max(MaxParticles, 4), 4);
+	if (PosX.Num() != Capacity)
+	{
+		DEC_DWORD_STAT_BY(STAT_FarmPourStreamParticles, NumParticles);
+		NumParticles = 0;
+
+		for (TArray<float>* Channel : { &PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &Age })
+		{
+			Channel->SetNumZeroed(Capacity);
+		}
+	}
+
+	if (IsEmitting())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UVRPourStreamComponent::StopEmitting()
+{
+	EmitterFlow = 0.0f;
+	EmitAccumulator = 0.0f;
+}
+
+void UVRPourStreamComponent::EmitParticles(float DeltaTime)
+{
+	if (!IsEmitting())
+	{
+		return;
+	}
+
+	EmitAccumulator += ParticlesPerSecond * EmitterFlow * DeltaTime;
+	const int32 NumWanted = FMath::FloorToInt(EmitAccumulator);
+	EmitAccumulator -= NumWanted;
+
+	// Sin sitio se pierde lo que sobra, no se acumula para el frame siguiente
+	const int32 NumToEmit = FMath::Min(NumWanted, FMath::Min(MaxParticles, PosX.Num()) - NumParticles);
+	if (NumToEmit <= 0)
+	{
+		return;
+	}
+
+	const float Speed = PourSpeed * FMath::Lerp(0.5f, 1.0f, EmitterFlow);
+	const float SpreadRadians = FMath::DegreesToRadians(SpreadAngle);
+
+	for (int32 Emitted = 0; Emitted < NumToEmit; ++Emitted)
+	{
+		const FVector Velocity = Random.VRandCone(EmitterDirection, SpreadRadians) * Speed;
+
+		// Repartidas a lo largo del frame para que el chorro no salga a golpes
+		const float Offset = Random.FRand() * DeltaTime;
+		const FVector Location = EmitterLocation + Velocity * Offset;
+
+		const int32 Index = NumParticles++;
+		PosX[Index] = Location.X;
+		PosY[Index] = Location.Y;
+		PosZ[Index] = Location.Z;
+		VelX[Index] = Velocity.X;
+		VelY[Index] = Velocity.Y;
+		VelZ[Index] = Velocity.Z;
+		Age[Index] = Offset;
+	}
+
+	INC_DWORD_STAT_BY(STAT_FarmPourStreamParticles, NumToEmit);
+}
+
+// ============================================================
+// SIMULATION
+// ============================================================
+
+void UVRPourStreamComponent::Simulate(float DeltaTime)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmPourStreamSimulate);
+
+	if (!IsEmitting() && NumParticles == 0)
+	{
+		return;
+	}
+
+	// El suelo se traza bajo donde cae el chorro; sin emisor, el agua en el aire usa el último.
+	// Un lote a la vez: hasta que vuelve, las colisiones usan el anterior
+	TimeSinceHeightfieldRefresh += DeltaTime;
+	if (PendingTraces == 0 && (Ground.Resolution == 0 || (IsEmitting() && TimeSinceHeightfieldRefresh >= HeightfieldRefreshInterval)))
+	{
+		const FVector Reach = FVector(EmitterDirection.X, EmitterDirection.Y, 0.0f) * PourSpeed * 0.25f;
+		RefreshHeightfield(EmitterLocation + Reach);
+	}
+
+	EmitParticles(DeltaTime);
+	IntegrateParticles(DeltaTime);
+	CollideParticles();
+}
+
+void UVRPourStreamComponent::IntegrateParticles(float DeltaTime)
+{
+	const VectorRegister4Float VecDeltaTime = VectorSetFloat1(DeltaTime);
+	const VectorRegister4Float VecGravityStep = VectorSetFloat1(Gravity * DeltaTime);
+
+	float* RESTRICT PX = PosX.GetData();
+	float* RESTRICT PY = PosY.GetData();
+	float* RESTRICT PZ = PosZ.GetData();
+	const float* RESTRICT VX = VelX.GetData();
+	const float* RESTRICT VY = VelY.GetData();
+	float* RESTRICT VZ = VelZ.GetData();
+	float* RESTRICT A = Age.GetData();
+
+	// Los huecos del último grupo se integran también; están fuera de NumParticles y no se leen
+	const int32 NumPadded = Align(NumParticles, 4);
+	for (int32 Index = 0; Index < NumPadded; Index += 4)
+	{
+		const VectorRegister4Float NewVelZ = VectorAdd(VectorLoad(VZ + Index), VecGravityStep);
+		VectorStore(NewVelZ, VZ + Index);
+
+		VectorStore(VectorMultiplyAdd(VectorLoad(VX + Index), VecDeltaTime, VectorLoad(PX + Index)), PX + Index);
+		VectorStore(VectorMultiplyAdd(VectorLoad(VY + Index), VecDeltaTime, VectorLoad(PY + Index)), PY + Index);
+		VectorStore(VectorMultiplyAdd(NewVelZ, VecDeltaTime, VectorLoad(PZ + Index)), PZ + Index);
+		VectorStore(VectorAdd(VectorLoad(A + Index), VecDeltaTime), A + Index);
+	}
+}
+
+void UVRPourStreamComponent::CollideParticles()
+{
+	const int32 NumBefore = NumParticles;
+
+	for (int32 Index = 0; Index < NumParticles;)
+	{
+		const int32 Cell = GetHeightfieldCell(PosX[Index], PosY[Index]);
+		if (Cell != INDEX_NONE && PosZ[Index] <= Ground.Heights[Cell])
+		{
+			AddImpact(Cell, FVector(PosX[Index], PosY[Index], Ground.Heights[Cell]));
+			RemoveParticle(Index);
+			continue;
+		}
+
+		// Fuera del área trazada o sin suelo debajo: se pierde al caducar
+		if (Age[Index] > MaxLifetime)
+		{
+			RemoveParticle(Index);
+			continue;
+		}
+
+		++Index;
+	}
+
+	DEC_DWORD_STAT_BY(STAT_FarmPourStreamParticles, NumBefore - NumParticles);
+}
+
+void UVRPourStreamComponent::RemoveParticle(int32 Index)
+{
+	// Swap con la última: el orden no importa
+	const int32 Last = --NumParticles;
+	PosX[Index] = PosX[Last];
+	PosY[Index] = PosY[Last];
+	PosZ[Index] = PosZ[Last];
+	VelX[Index] = VelX[Last];
+	VelY[Index] = VelY[Last];
+	VelZ[Index] = VelZ[Last];
+	Age[Index] = Age[Last];
+}
+
+// ============================================================
+// GROUND HEIGHTFIELD
+// ============================================================
+
+void UVRPourStreamComponent::RefreshHeightfield(const FVector& Center)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmPourStreamHeightfield);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const int32 Resolution = FMath::Clamp(HeightfieldResolution, 2, 64);
+	const int32 NumCells = Resolution * Resolution;
+
+	PendingGround.Heights.SetNumUninitialized(NumCells);
+	PendingGround.Actors.SetNum(NumCells);
+	PendingGround.Items.SetNumUninitialized(NumCells);
+	PendingGround.Valid.SetNumUninitialized(NumCells);
+	PendingGround.Resolution = Resolution;
+	PendingGround.CellSize = HeightfieldSize / Resolution;
+	PendingGround.Origin = FVector2D(Center) - FVector2D(HeightfieldSize * 0.5f);
+
+	TimeSinceHeightfieldRefresh = 0.0f;
+	PendingTraces = NumCells;
+	++HeightfieldBatch;
+
+	// Ni la regadera ni la mano que la sostiene son suelo
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PourStreamHeightfield), false, GetOwner());
+	if (AActor* Holder = GetOwner() ? GetOwner()->GetAttachParentActor() : nullptr)
+	{
+		QueryParams.AddIgnoredActor(Holder);
+	}
+
+	const float StartZ = EmitterLocation.Z;
+	const float EndZ = EmitterLocation.Z - MaxTraceDepth;
+
+	// Se resuelven fuera del game thread durante el frame; los resultados llegan en el siguiente
+	const FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &UVRPourStreamComponent::OnHeightfieldTrace);
+	const uint32 BatchBits = (HeightfieldBatch & VRPourStream::CellMask) << VRPourStream::BatchShift;
+
+	FARM_COUNTER_ADD(SceneQueries, NumCells);
+	for (int32 Cell = 0; Cell < NumCells; ++Cell)
+	{
+		const FVector2D CellCenter = PendingGround.Origin + FVector2D((Cell % Resolution) + 0.5f, (Cell / Resolution) + 0.5f) * PendingGround.CellSize;
+
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single,
+			FVector(CellCenter.X, CellCenter.Y, StartZ),
+			FVector(CellCenter.X, CellCenter.Y, EndZ),
+			ECC_Visibility, QueryParams, FCollisionResponseParams::DefaultResponseParam,
+			&TraceDelegate, BatchBits | static_cast<uint32>(Cell));
+	}
+}
+
+void UVRPourStreamComponent::OnHeightfieldTrace(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	// De un lote abandonado
+	if ((Datum.UserData >> VRPourStream::BatchShift) != (HeightfieldBatch & VRPourStream::CellMask) || PendingTraces <= 0)
+	{
+		return;
+	}
+
+	const int32 Cell = static_cast<int32>(Datum.UserData & VRPourStream::CellMask);
+	if (!PendingGround.Valid.IsValidIndex(Cell))
+	{
+		return;
+	}
+
+	const FHitResult* Hit = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit ? &Datum.OutHits[0] : nullptr;
+	PendingGround.Valid[Cell] = Hit != nullptr;
+	PendingGround.Heights[Cell] = Hit ? Hit->ImpactPoint.Z : Datum.End.Z;
+	PendingGround.Actors[Cell] = Hit ? Hit->GetActor() : nullptr;
+	PendingGround.Items[Cell] = Hit ? Hit->Item : INDEX_NONE;
+
+	// Completo: pasa a ser el de las colisiones
+	if (--PendingTraces == 0)
+	{
+		Swap(Ground, PendingGround);
+	}
+}
+
+int32 UVRPourStreamComponent::GetHeightfieldCell(float X, float Y) const
+{
+	if (Ground.Resolution == 0 || Ground.CellSize <= 0.0f)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Column = FMath::FloorToInt((X - Ground.Origin.X) / Ground.CellSize);
+	const int32 Row = FMath::FloorToInt((Y - Ground.Origin.Y) / Ground.CellSize);
+	if (Column < 0 || Column >= Ground.Resolution || Row < 0 || Row >= Ground.Resolution)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Cell = Row * Ground.Resolution + Column;
+	return Ground.Valid.IsValidIndex(Cell) && Ground.Valid[Cell] ? Cell : INDEX_NONE;
+}
+
+// ============================================================
+// IMPACTS
+// ============================================================
+
+void UVRPourStreamComponent::AddImpact(int32 Cell, const FVector& Location)
+{
+	const TWeakObjectPtr<AActor>& Actor = Ground.Actors[Cell];
+	const int32 Item = Ground.Items[Cell];
+
+	// Pocos actores a la vez bajo el chorro: búsqueda lineal
+	FVRPourImpact* Impact = PendingImpacts.FindByPredicate([&Actor, Item](const FVRPourImpact& Entry)
+	{
+		return Entry.Actor == Actor && Entry.Item == Item;
+	});
+
+	if (!Impact)
+	{
+		Impact = &PendingImpacts.AddDefaulted_GetRef();
+		Impact->Actor = Actor;
+		Impact->Item = Item;
+	}
+
+	Impact->Location += Location;
+	++Impact->NumParticles;
+}
+
+void UVRPourStreamComponent::ConsumeImpacts(TArray<FVRPourImpact>& OutImpacts)
+{
+	for (FVRPourImpact& Impact : PendingImpacts)
+	{
+		Impact.Location /= Impact.NumParticles;
+	}
+
+	OutImpacts = MoveTemp(PendingImpacts);
+	PendingImpacts.Reset();
+}
\ No newline at end of file
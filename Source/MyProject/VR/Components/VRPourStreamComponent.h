@@ -0,0 +1,166 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "VRPourStreamComponent.generated.h"
+
+// Agua que cayó sobre un mismo actor (y elemento: celda de un campo de parcelas)
+struct FVRPourImpact
+{
+	TWeakObjectPtr<AActor> Actor;
+	int32 Item = INDEX_NONE;
+
+	// Punto medio de los impactos
+	FVector Location = FVector::ZeroVector;
+	int32 NumParticles = 0;
+};
+
+// Heightfield bajo el chorro (índice = celda): altura del suelo y actor/elemento que la trazó
+struct FVRPourHeightfield
+{
+	TArray<float> Heights;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<int32> Items;
+	TArray<bool> Valid;
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 0.0f;
+
+	// 0 mientras no se ha trazado nunca
+	int32 Resolution = 0;
+};
+
+/**
+ * Chorro de agua balístico simulado en CPU, sin física ni GPU.
+ * - Partículas en arrays por componente (SoA), integradas de 4 en 4 con SIMD
+ * - El suelo es un heightfield pequeño bajo el chorro: HeightfieldResolution² trazas verticales
+ *   (144 por defecto) cada HeightfieldRefreshInterval, asíncronas, y ninguna por partícula.
+ *   Mientras vuelven se sigue usando el heightfield anterior
+ * - Cada celda del heightfield recuerda qué actor había debajo (cultivo, parcela); los impactos
+ *   se agrupan por ese actor y el dueño los recoge con ConsumeImpacts
+ * Coste acotado por MaxParticles y HeightfieldResolution, no por los cultivos del mundo.
+ */
+UCLASS(BlueprintType, Blueprintable, ClassGroup=(VR), meta=(BlueprintSpawnableComponent))
+class MYPROJECT_API UVRPourStreamComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVRPourStreamComponent();
+
+protected:
+	// Configuración del chorro
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream", meta = (ClampMin = "4"))
+	int32 MaxParticles = 2048;
+
+	// Partículas por segundo con caudal 1
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream", meta = (ClampMin = "1.0"))
+	float ParticlesPerSecond = 400.0f;
+
+	// Velocidad de salida con caudal 1 (cm/s); con poco caudal el agua sale más lenta
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream")
+	float PourSpeed = 180.0f;
+
+	// Apertura del chorro (grados)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream")
+	float SpreadAngle = 6.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream")
+	float Gravity = -980.0f;
+
+	// Las partículas que no tocan suelo en este tiempo se descartan (segundos)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream")
+	float MaxLifetime = 2.0f;
+
+	// Configuración del heightfield: Resolution² trazas en cada refresco
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream|Ground", meta = (ClampMin = "2", ClampMax = "64"))
+	int32 HeightfieldResolution = 12;
+
+	// Lado del área muestreada bajo el chorro (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream|Ground")
+	float HeightfieldSize = 200.0f;
+
+	// Cada cuánto se vuelve a trazar el suelo mientras hay agua en el aire (segundos)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream|Ground")
+	float HeightfieldRefreshInterval = 0.2f;
+
+	// Profundidad de las trazas bajo el pico (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pour Stream|Ground")
+	float MaxTraceDepth = 400.0f;
+
+public:
+	// Posición y dirección del pico; Flow (0-1) escala partículas por segundo y velocidad de salida
+	void SetEmitter(const FVector& Location, const FVector& Direction, float Flow);
+
+	// Deja de emitir; el agua en el aire sigue cayendo
+	void StopEmitting();
+
+	// Impactos desde la última llamada, agrupados por actor/elemento
+	void ConsumeImpacts(TArray<FVRPourImpact>& OutImpacts);
+
+	// Avanza el chorro (TickComponent, o directamente desde los microbenchmarks)
+	void Simulate(float DeltaTime);
+
+	UFUNCTION(BlueprintPure, Category = "Pour Stream")
+	int32 GetNumParticles() const { return NumParticles; }
+
+	UFUNCTION(BlueprintPure, Category = "Pour Stream")
+	bool IsEmitting() const { return EmitterFlow > 0.0f; }
+
+	float GetParticlesPerSecond() const { return ParticlesPerSecond; }
+
+	FVector GetParticleLocation(int32 Index) const { return FVector(PosX[Index], PosY[Index], PosZ[Index]); }
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	void EmitParticles(float DeltaTime);
+
+	// v += g*dt; p += v*dt, 4 partículas por iteración
+	void IntegrateParticles(float DeltaTime);
+
+	// Contra el heightfield: los que tocan suelo se apuntan al impacto de su celda y se quitan
+	void CollideParticles();
+
+	// Lanza las trazas verticales (asíncronas) de una cuadrícula centrada en Center
+	void RefreshHeightfield(const FVector& Center);
+
+	// Resultado de una traza; con la última del lote se publica el heightfield nuevo
+	void OnHeightfieldTrace(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	// Celda del heightfield bajo (X, Y), INDEX_NONE fuera o sin suelo
+	int32 GetHeightfieldCell(float X, float Y) const;
+
+	void AddImpact(int32 Cell, const FVector& Location);
+	void RemoveParticle(int32 Index);
+
+	// Estado de las partículas (SoA). Capacidad redondeada a múltiplo de 4 para el SIMD
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> PosZ;
+	TArray<float> VelX;
+	TArray<float> VelY;
+	TArray<float> VelZ;
+	TArray<float> Age;
+	int32 NumParticles = 0;
+
+	// El que usan las colisiones y el que se está trazando
+	FVRPourHeightfield Ground;
+	FVRPourHeightfield PendingGround;
+	int32 PendingTraces = 0;
+
+	// Distingue las trazas del lote en curso de las de uno abandonado (EndPlay)
+	uint32 HeightfieldBatch = 0;
+	float TimeSinceHeightfieldRefresh = 0.0f;
+
+	// Impactos pendientes de recoger (Location acumula la suma)
+	TArray<FVRPourImpact> PendingImpacts;
+
+	// Emisor
+	FVector EmitterLocation = FVector::ZeroVector;
+	FVector EmitterDirection = FVector::ForwardVector;
+	float EmitterFlow = 0.0f;
+	float EmitAccumulator = 0.0f;
+	FRandomStream Random;
+};
\ No newline at end of file
@@ -0,0 +1,426 @@
+#include "VRSessionRecorderComponent.h"
+#include "MyProject/VR/Components/VRInputComponent.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DECLARE_CYCLE_STAT(TEXT("VR Session Recorder Tick"), STAT_FarmSessionRecorderTick, STATGROUP_HarvestHaven);
+
+namespace VRSession
+{
+	static constexpr uint32 Magic = 0x52535256; // "VRSR"
+	static constexpr uint16 Version = 1;
+
+	static UVRSessionRecorderComponent* FindRecorder(UWorld* World)
+	{
+		APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+		APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		return Pawn ? Pawn->FindComponentByClass<UVRSessionRecorderComponent>() : nullptr;
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("farm.VRSession.Record"),
+		TEXT("Record HMD/controller poses and VR input to Saved/VRSessions/<Name>.vrsession"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UVRSessionRecorderComponent* Recorder = FindRecorder(World))
+			{
+				Recorder->StartRecording(Args.Num() > 0 ? Args[0] : TEXT("Session"));
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("farm.VRSession.Replay"),
+		TEXT("Replay Saved/VRSessions/<Name>.vrsession into the player pawn"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UVRSessionRecorderComponent* Recorder = FindRecorder(World))
+			{
+				Recorder->StartReplay(Args.Num() > 0 ? Args[0] : TEXT("Session"));
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("farm.VRSession.Stop"),
+		TEXT("Stop the current VR session recording or replay"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UVRSessionRecorderComponent* Recorder = FindRecorder(World))
+			{
+				Recorder->Stop();
+			}
+		}));
+}
+
+UVRSessionRecorderComponent::UVRSessionRecorderComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void UVRSessionRecorderComponent::SetTrackedComponents(USceneComponent* InCamera, const TArray<USceneComponent*>& InControllers)
+{
+	TrackedComponents.Reset();
+	TrackedComponents.Add(InCamera);
+	TrackedComponents.Append(InControllers);
+
+	// Sample (or overwrite) poses after the controllers have polled tracking this frame
+	for (USceneComponent* Component : TrackedComponents)
+	{
+		if (Component && Component->PrimaryComponentTick.bCanEverTick)
+		{
+			PrimaryComponentTick.AddPrerequisite(Component, Component->PrimaryComponentTick);
+		}
+	}
+}
+
+void UVRSessionRecorderComponent::SetInputComponent(UVRInputComponent* InInputComponent)
+{
+	InputComponent = InInputComponent;
+}
+
+FString UVRSessionRecorderComponent::GetSessionFilePath(const FString& SessionName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("VRSessions") / (SessionName + TEXT(".vrsession"));
+}
+
+bool UVRSessionRecorderComponent::StartRecording(const FString& SessionName)
+{
+	Stop();
+
+	if (!InputComponent)
+	{
+		UE_LOG(LogTemp, Error, TEXT("VRSessionRecorder: No input component to record"));
+		return false;
+	}
+
+	const FString FilePath = GetSessionFilePath(SessionName);
+	SessionArchive.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!SessionArchive)
+	{
+		UE_LOG(LogTemp, Error, TEXT("VRSessionRecorder: Cannot write %s"), *FilePath);
+		return false;
+	}
+
+	WriteHeader();
+	InputActionHandle = InputComponent->OnInputAction.AddUObject(this, &UVRSessionRecorderComponent::OnInputAction);
+
+	Mode = EVRSessionMode::Recording;
+	CurrentSessionName = SessionName;
+	FrameIndex = 0;
+	PendingActions.Reset();
+	SetComponentTickEnabled(true);
+
+	UE_LOG(LogTemp, Log, TEXT("VRSessionRecorder: Recording to %s"), *FilePath);
+	return true;
+}
+
+bool UVRSessionRecorderComponent::StartReplay(const FString& SessionName)
+{
+	Stop();
+
+	if (!InputComponent)
+	{
+		UE_LOG(LogTemp, Error, TEXT("VRSessionRecorder: No input component to replay into"));
+		return false;
+	}
+
+	const FString FilePath = GetSessionFilePath(SessionName);
+	SessionArchive.Reset(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!SessionArchive || !ReadHeader())
+	{
+		UE_LOG(LogTemp, Error, TEXT("VRSessionRecorder: Cannot read session %s"), *FilePath);
+		SessionArchive.Reset();
+		return false;
+	}
+
+	Mode = EVRSessionMode::Replaying;
+	CurrentSessionName = SessionName;
+	FrameIndex = 0;
+	ReplayFrameTimes.Reset();
+	LastReplayFrameSeconds = 0.0;
+	SetComponentTickEnabled(true);
+
+	UE_LOG(LogTemp, Log, TEXT("VRSessionRecorder: Replaying %s"), *FilePath);
+	return true;
+}
+
+void UVRSessionRecorderComponent::Stop()
+{
+	if (Mode == EVRSessionMode::Recording)
+	{
+		if (InputComponent)
+		{
+			InputComponent->OnInputAction.Remove(InputActionHandle);
+		}
+		InputActionHandle.Reset();
+
+		UE_LOG(LogTemp, Log, TEXT("VRSessionRecorder: Recorded %d frames (%lld bytes) to %s"),
+			FrameIndex, SessionArchive ? SessionArchive->Tell() : 0, *CurrentSessionName);
+	}
+	else if (Mode == EVRSessionMode::Replaying)
+	{
+		FinishReplay();
+	}
+
+	if (SessionArchive)
+	{
+		SessionArchive->Close();
+		SessionArchive.Reset();
+	}
+
+	Mode = EVRSessionMode::Idle;
+	SetComponentTickEnabled(false);
+}
+
+void UVRSessionRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Stop();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UVRSessionRecorderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSessionRecorderTick);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (Mode == EVRSessionMode::Recording)
+	{
+		WriteFrame(DeltaTime);
+		++FrameIndex;
+	}
+	else if (Mode == EVRSessionMode::Replaying)
+	{
+		// Wall-clock frame time: with -benchmark the engine delta is fixed
+		const double Now = FPlatformTime::Seconds();
+		if (LastReplayFrameSeconds > 0.0)
+		{
+			ReplayFrameTimes.Add(static_cast<float>((Now - LastReplayFrameSeconds) * 1000.0));
+		}
+		LastReplayFrameSeconds = Now;
+
+		if (ReadAndApplyFrame())
+		{
+			++FrameIndex;
+		}
+		else
+		{
+			const bool bExit = bExitWhenReplayFinishes;
+			Stop();
+
+			if (bExit)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+		}
+	}
+}
+
+void UVRSessionRecorderComponent::OnInputAction(EVRInputActionId ActionId, const FInputActionValue& Value)
+{
+	FRecordedAction& Action = PendingActions.AddDefaulted_GetRef();
+	Action.ActionId = static_cast<uint8>(ActionId);
+	Action.ValueType = static_cast<uint8>(Value.GetValueType());
+	Action.Value = FVector3f(Value.Get<FVector>());
+}
+
+// ============================================================
+// STREAM FORMAT
+// header: magic, version, pose count
+// frame:  delta time, pose per tracked component, action count, actions
+// ============================================================
+
+void UVRSessionRecorderComponent::WriteHeader()
+{
+	FArchive& Ar = *SessionArchive;
+
+	uint32 FileMagic = VRSession::Magic;
+	uint16 FileVersion = VRSession::Version;
+	uint8 PoseCount = static_cast<uint8>(TrackedComponents.Num());
+	Ar << FileMagic << FileVersion << PoseCount;
+}
+
+bool UVRSessionRecorderComponent::ReadHeader()
+{
+	FArchive& Ar = *SessionArchive;
+
+	uint32 FileMagic = 0;
+	uint16 FileVersion = 0;
+	uint8 PoseCount = 0;
+	Ar << FileMagic << FileVersion << PoseCount;
+
+	if (FileMagic != VRSession::Magic || FileVersion != VRSession::Version || PoseCount != TrackedComponents.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("VRSessionRecorder: Incompatible session (version %d, %d poses)"), FileVersion, PoseCount);
+		return false;
+	}
+
+	return !Ar.IsError();
+}
+
+void UVRSessionRecorderComponent::WriteFrame(float DeltaTime)
+{
+	FArchive& Ar = *SessionArchive;
+
+	Ar << DeltaTime;
+
+	for (USceneComponent* Component : TrackedComponents)
+	{
+		WritePose(Ar, Component ? Component->GetRelativeTransform() : FTransform::Identity);
+	}
+
+	// Actions carry only the axes their value type uses
+	uint8 ActionCount = static_cast<uint8>(FMath::Min(PendingActions.Num(), 255));
+	Ar << ActionCount;
+
+	for (int32 Index = 0; Index < ActionCount; ++Index)
+	{
+		FRecordedAction& Action = PendingActions[Index];
+		Ar << Action.ActionId << Action.ValueType;
+
+		const int32 AxisCount = FMath::Max(1, static_cast<int32>(Action.ValueType));
+		for (int32 Axis = 0; Axis < AxisCount && Axis < 3; ++Axis)
+		{
+			Ar << Action.Value[Axis];
+		}
+	}
+
+	PendingActions.Reset();
+}
+
+bool UVRSessionRecorderComponent::ReadAndApplyFrame()
+{
+	FArchive& Ar = *SessionArchive;
+	if (Ar.AtEnd())
+	{
+		return false;
+	}
+
+	float RecordedDeltaTime = 0.0f;
+	Ar << RecordedDeltaTime;
+
+	for (USceneComponent* Component : TrackedComponents)
+	{
+		const FTransform Pose = ReadPose(Ar);
+		if (Component)
+		{
+			Component->SetRelativeTransform(Pose);
+		}
+	}
+
+	uint8 ActionCount = 0;
+	Ar << ActionCount;
+
+	for (int32 Index = 0; Index < ActionCount; ++Index)
+	{
+		FRecordedAction Action;
+		Ar << Action.ActionId << Action.ValueType;
+
+		const int32 AxisCount = FMath::Max(1, static_cast<int32>(Action.ValueType));
+		for (int32 Axis = 0; Axis < AxisCount && Axis < 3; ++Axis)
+		{
+			Ar << Action.Value[Axis];
+		}
+
+		if (Ar.IsError())
+		{
+			return false;
+		}
+
+		if (Action.ActionId < static_cast<uint8>(EVRInputActionId::Count))
+		{
+			const FInputActionValue Value(static_cast<EInputActionValueType>(Action.ValueType), FVector(Action.Value));
+			InputComponent->ReplayAction(static_cast<EVRInputActionId>(Action.ActionId), Value);
+		}
+	}
+
+	return !Ar.IsError();
+}
+
+void UVRSessionRecorderComponent::WritePose(FArchive& Ar, const FTransform& Pose)
+{
+	FVector3f Location(Pose.GetLocation());
+	Ar << Location;
+
+	// Smallest form of a unit quaternion: xyz as int16 with w >= 0 rebuilt on read
+	FQuat Rotation = Pose.GetRotation().GetNormalized();
+	if (Rotation.W < 0.0)
+	{
+		Rotation = FQuat(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+	}
+
+	int16 X = static_cast<int16>(FMath::RoundToInt(Rotation.X * 32767.0));
+	int16 Y = static_cast<int16>(FMath::RoundToInt(Rotation.Y * 32767.0));
+	int16 Z = static_cast<int16>(FMath::RoundToInt(Rotation.Z * 32767.0));
+	Ar << X << Y << Z;
+}
+
+FTransform UVRSessionRecorderComponent::ReadPose(FArchive& Ar)
+{
+	FVector3f Location;
+	Ar << Location;
+
+	int16 X = 0, Y = 0, Z = 0;
+	Ar << X << Y << Z;
+
+	const double QX = X / 32767.0;
+	const double QY = Y / 32767.0;
+	const double QZ = Z / 32767.0;
+	const double QW = FMath::Sqrt(FMath::Max(0.0, 1.0 - QX * QX - QY * QY - QZ * QZ));
+
+	return FTransform(FQuat(QX, QY, QZ, QW).GetNormalized(), FVector(Location));
+}
+
+void UVRSessionRecorderComponent::FinishReplay()
+{
+	UE_LOG(LogTemp, Log, TEXT("VRSessionRecorder: Replay of %s finished after %d frames"), *CurrentSessionName, FrameIndex);
+
+	if (ReplayFrameTimes.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<float> Sorted = ReplayFrameTimes;
+	Sorted.Sort();
+
+	auto Percentile = [&Sorted](float Fraction)
+	{
+		return Sorted[FMath::Clamp(FMath::FloorToInt(Fraction * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+	};
+
+	double Total = 0.0;
+	for (float FrameMs : Sorted)
+	{
+		Total += FrameMs;
+	}
+
+	const float AverageMs = static_cast<float>(Total / Sorted.Num());
+	const float MedianMs = Percentile(0.5f);
+
+	int32 HitchCount = 0;
+	for (float FrameMs : Sorted)
+	{
+		HitchCount += FrameMs > MedianMs * 2.0f ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("VRSessionRecorder: %s frames=%d avg=%.2fms p50=%.2fms p95=%.2fms p99=%.2fms max=%.2fms hitches(>2x p50)=%d"),
+		*CurrentSessionName, Sorted.Num(), AverageMs, MedianMs, Percentile(0.95f), Percentile(0.99f), Sorted.Last(), HitchCount);
+
+	FString Csv = TEXT("Frame,FrameMs\n");
+	for (int32 Index = 0; Index < ReplayFrameTimes.Num(); ++Index)
+	{
+		Csv += FString::Printf(TEXT("%d,%.3f\n"), Index, ReplayFrameTimes[Index]);
+	}
+
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("VRSessions") / (CurrentSessionName + TEXT("_frametimes.csv"));
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+}
\ No newline at end of file
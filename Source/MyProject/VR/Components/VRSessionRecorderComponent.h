@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputActionValue.h"
+#include "VRSessionRecorderComponent.generated.h"
+
+class UVRInputComponent;
+class USceneComponent;
+enum class EVRInputActionId : uint8;
+
+UENUM(BlueprintType)
+enum class EVRSessionMode : uint8
+{
+	Idle,
+	Recording,
+	Replaying
+};
+
+/**
+ * Records HMD and motion controller poses plus every UVRInputComponent action into a compact
+ * binary stream (Saved/VRSessions/<Name>.vrsession), and plays it back into the pawn with no HMD.
+ *
+ * Poses are stored relative to VROrigin, one frame per engine frame. Replay is frame-locked, so
+ * run with a fixed frame rate for comparable numbers, e.g.:
+ *   MyProject -game -nullrhi -benchmark -fps=72 -VRReplay=Planting -VRReplayExit
+ * Replay writes frame-time stats to Saved/VRSessions/<Name>_frametimes.csv and the log.
+ */
+UCLASS(BlueprintType, Blueprintable, ClassGroup=(VR), meta=(BlueprintSpawnableComponent))
+class MYPROJECT_API UVRSessionRecorderComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVRSessionRecorderComponent();
+
+	// Tracked components in stream order: HMD camera, then the motion controllers
+	void SetTrackedComponents(USceneComponent* InCamera, const TArray<USceneComponent*>& InControllers);
+	void SetInputComponent(UVRInputComponent* InInputComponent);
+
+	UFUNCTION(BlueprintCallable, Category = "VR Session")
+	bool StartRecording(const FString& SessionName);
+
+	UFUNCTION(BlueprintCallable, Category = "VR Session")
+	bool StartReplay(const FString& SessionName);
+
+	UFUNCTION(BlueprintCallable, Category = "VR Session")
+	void Stop();
+
+	UFUNCTION(BlueprintPure, Category = "VR Session")
+	EVRSessionMode GetMode() const { return Mode; }
+
+	UFUNCTION(BlueprintPure, Category = "VR Session")
+	int32 GetFrameIndex() const { return FrameIndex; }
+
+	// Quit the game when a replay finishes (benchmark runs)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR Session")
+	bool bExitWhenReplayFinishes = false;
+
+	static FString GetSessionFilePath(const FString& SessionName);
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	struct FRecordedAction
+	{
+		uint8 ActionId = 0;
+		uint8 ValueType = 0;
+		FVector3f Value = FVector3f::ZeroVector;
+	};
+
+	void OnInputAction(EVRInputActionId ActionId, const FInputActionValue& Value);
+
+	void WriteHeader();
+	void WriteFrame(float DeltaTime);
+	bool ReadHeader();
+	bool ReadAndApplyFrame();
+	void FinishReplay();
+
+	static void WritePose(FArchive& Ar, const FTransform& Pose);
+	static FTransform ReadPose(FArchive& Ar);
+
+	UPROPERTY()
+	TArray<USceneComponent*> TrackedComponents;
+
+	UPROPERTY()
+	UVRInputComponent* InputComponent = nullptr;
+
+	EVRSessionMode Mode = EVRSessionMode::Idle;
+	FString CurrentSessionName;
+	TUniquePtr<FArchive> SessionArchive;
+	FDelegateHandle InputActionHandle;
+
+	// Actions received since the last recorded frame
+	TArray<FRecordedAction> PendingActions;
+
+	int32 FrameIndex = 0;
+	TArray<float> ReplayFrameTimes;
+	double LastReplayFrameSeconds = 0.0;
+};
\ No newline at end of file
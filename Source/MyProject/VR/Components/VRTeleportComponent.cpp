@@ -1,10 +1,13 @@
 #include "VRTeleportComponent.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
 #include "Camera/CameraComponent.h"
 #include "Components/SceneComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("Teleport Trace"), STAT_FarmTeleportTrace, STATGROUP_HarvestHaven);
+
 UVRTeleportComponent::UVRTeleportComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -50,6 +53,9 @@ void UVRTeleportComponent::UpdateTeleportTrace(const FVector& StartPos, const FV
 		return;
 	}
 
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmTeleportTrace);
+	FARM_COUNTER_INC(SceneQueries);
+
 	TeleportTracePathPositions.Empty();
 
 	FPredictProjectilePathParams PathParams;
@@ -125,6 +131,8 @@ void UVRTeleportComponent::EndTeleportTrace()
 
 bool UVRTeleportComponent::TryExecuteTeleport()
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_Teleport);
+
 	if (!bValidTeleportLocation || ProjectedTeleportLocation == FVector::ZeroVector)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("VRTeleportComponent: Teleportation failed - invalid location"));
@@ -216,9 +224,9 @@ bool UVRTeleportComponent::IsValidSurfaceAngle(const FVector& Location) const
 	FVector TraceStart = Location + FVector(0, 0, SURFACE_TRACE_DISTANCE);
 	FVector TraceEnd = Location - FVector(0, 0, SURFACE_TRACE_DISTANCE);
 	
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(GetOwner());
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TeleportSurfaceAngle), false, GetOwner());
 
+	FARM_COUNTER_INC(SceneQueries);
 	if (GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
 	{
 		FVector SurfaceNormal = HitResult.Normal;
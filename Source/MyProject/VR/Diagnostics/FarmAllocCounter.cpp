@@ -0,0 +1,101 @@
+// ==================================================================
+// FarmAllocCounter.cpp
+// ==================================================================
+
+#include "FarmAllocCounter.h"
+#include <atomic>
+
+namespace FarmAllocCounter
+{
+	/** Forwards to the real allocator and counts every call. */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Allocations.fetch_add(1, std::memory_order_relaxed);
+			Bytes.fetch_add(Count, std::memory_order_relaxed);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Allocations.fetch_add(1, std::memory_order_relaxed);
+				Bytes.fetch_add(Count, std::memory_order_relaxed);
+			}
+			if (Original && Count == 0)
+			{
+				Frees.fetch_add(1, std::memory_order_relaxed);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			if (Original)
+			{
+				Frees.fetch_add(1, std::memory_order_relaxed);
+			}
+			Inner->Free(Original);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("FarmAllocCounter"); }
+
+		FMalloc* Inner;
+		std::atomic<uint64> Allocations{0};
+		std::atomic<uint64> Frees{0};
+		std::atomic<uint64> Bytes{0};
+	};
+
+	// Wraps whatever GMalloc was the first time a counter opened; leaked on purpose
+	FCountingMalloc& GetCountingMalloc(FMalloc* Inner)
+	{
+		static FCountingMalloc* CountingMalloc = new FCountingMalloc(Inner);
+		return *CountingMalloc;
+	}
+}
+
+FFarmAllocCounter::FFarmAllocCounter()
+{
+	PreviousMalloc = GMalloc;
+
+	FarmAllocCounter::FCountingMalloc& CountingMalloc = FarmAllocCounter::GetCountingMalloc(GMalloc);
+	StartAllocations = CountingMalloc.Allocations.load();
+	StartFrees = CountingMalloc.Frees.load();
+	StartBytes = CountingMalloc.Bytes.load();
+
+	GMalloc = &CountingMalloc;
+}
+
+FFarmAllocCounter::~FFarmAllocCounter()
+{
+	GMalloc = PreviousMalloc;
+}
+
+uint64 FFarmAllocCounter::GetAllocations() const
+{
+	return FarmAllocCounter::GetCountingMalloc(nullptr).Allocations.load() - StartAllocations;
+}
+
+uint64 FFarmAllocCounter::GetFrees() const
+{
+	return FarmAllocCounter::GetCountingMalloc(nullptr).Frees.load() - StartFrees;
+}
+
+uint64 FFarmAllocCounter::GetBytes() const
+{
+	return FarmAllocCounter::GetCountingMalloc(nullptr).Bytes.load() - StartBytes;
+}
\ No newline at end of file
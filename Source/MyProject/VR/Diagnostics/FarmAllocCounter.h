@@ -0,0 +1,35 @@
+// ==================================================================
+// FarmAllocCounter.h
+// Heap allocation counts for the benchmarks (GMalloc wrapped while in scope)
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts heap allocations, frees and requested bytes while in scope, for every thread.
+ *
+ * GMalloc is routed through a forwarding allocator that is created once and never freed,
+ * so a thread still inside it after the scope ends is safe. Reallocs count as allocations.
+ * Scopes may nest; each reports what happened since it was opened.
+ */
+class MYPROJECT_API FFarmAllocCounter
+{
+public:
+	FFarmAllocCounter();
+	~FFarmAllocCounter();
+
+	FFarmAllocCounter(const FFarmAllocCounter&) = delete;
+	FFarmAllocCounter& operator=(const FFarmAllocCounter&) = delete;
+
+	uint64 GetAllocations() const;
+	uint64 GetFrees() const;
+	uint64 GetBytes() const;
+
+private:
+	FMalloc* PreviousMalloc = nullptr;
+	uint64 StartAllocations = 0;
+	uint64 StartFrees = 0;
+	uint64 StartBytes = 0;
+};
\ No newline at end of file
@@ -0,0 +1,112 @@
+// ==================================================================
+// FarmDebugDraw.cpp
+// ==================================================================
+
+#include "FarmDebugDraw.h"
+#include "MyProject/VR/Subsystems/FarmDebugDrawSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+#if FARM_DEBUG_DRAW_ENABLED
+
+namespace FarmDebugDraw
+{
+	TAutoConsoleVariable<bool> CVarAll(TEXT("farm.Debug.All"), false, TEXT("Draw debug shapes for every farm system."));
+
+	TAutoConsoleVariable<bool> CVarSystems[] =
+	{
+		{ TEXT("farm.Debug.Watering"), false, TEXT("Draw watering can tilt, water sources and watered crops.") },
+		{ TEXT("farm.Debug.Digging"), false, TEXT("Draw the digging tool tip and dig stamps.") },
+		{ TEXT("farm.Debug.Seeds"), false, TEXT("Draw seed planting checks.") },
+		{ TEXT("farm.Debug.Hands"), false, TEXT("Draw hand bones and axes.") },
+	};
+	static_assert(UE_ARRAY_COUNT(CVarSystems) == static_cast<SIZE_T>(EFarmDebugSystem::Count), "One console variable per EFarmDebugSystem");
+
+	UFarmDebugDrawSubsystem* GetSubsystem(EFarmDebugSystem System, const UObject* WorldContext)
+	{
+		return FFarmDebugDraw::IsEnabled(System) ? UFarmDebugDrawSubsystem::Get(WorldContext) : nullptr;
+	}
+
+	void AddCircle(UFarmDebugDrawSubsystem& Subsystem, const FVector& Center, const FVector& AxisX, const FVector& AxisY, float Radius, int32 Segments, const FColor& Color, float LifeTime, float Thickness)
+	{
+		const float AngleStep = 2.0f * PI / Segments;
+		FVector Previous = Center + AxisX * Radius;
+
+		for (int32 Index = 1; Index <= Segments; ++Index)
+		{
+			float Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, AngleStep * Index);
+
+			const FVector Next = Center + (AxisX * Cos + AxisY * Sin) * Radius;
+			Subsystem.AddLine(Previous, Next, Color, LifeTime, Thickness);
+			Previous = Next;
+		}
+	}
+}
+
+bool FFarmDebugDraw::IsEnabled(EFarmDebugSystem System)
+{
+	return FarmDebugDraw::CVarAll.GetValueOnGameThread()
+		|| FarmDebugDraw::CVarSystems[static_cast<int32>(System)].GetValueOnGameThread();
+}
+
+void FFarmDebugDraw::Line(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Start, const FVector& End, const FColor& Color, float LifeTime, float Thickness)
+{
+	if (UFarmDebugDrawSubsystem* Subsystem = FarmDebugDraw::GetSubsystem(System, WorldContext))
+	{
+		Subsystem->AddLine(Start, End, Color, LifeTime, Thickness);
+	}
+}
+
+void FFarmDebugDraw::Sphere(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Center, float Radius, int32 Segments, const FColor& Color, float LifeTime, float Thickness)
+{
+	UFarmDebugDrawSubsystem* Subsystem = FarmDebugDraw::GetSubsystem(System, WorldContext);
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	// Three great circles instead of the engine's full lat/long wireframe
+	Segments = FMath::Max(Segments, 4);
+	FarmDebugDraw::AddCircle(*Subsystem, Center, FVector::ForwardVector, FVector::RightVector, Radius, Segments, Color, LifeTime, Thickness);
+	FarmDebugDraw::AddCircle(*Subsystem, Center, FVector::ForwardVector, FVector::UpVector, Radius, Segments, Color, LifeTime, Thickness);
+	FarmDebugDraw::AddCircle(*Subsystem, Center, FVector::RightVector, FVector::UpVector, Radius, Segments, Color, LifeTime, Thickness);
+}
+
+void FFarmDebugDraw::Arrow(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color, float LifeTime, float Thickness)
+{
+	UFarmDebugDrawSubsystem* Subsystem = FarmDebugDraw::GetSubsystem(System, WorldContext);
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	Subsystem->AddLine(Start, End, Color, LifeTime, Thickness);
+
+	const FVector Direction = (End - Start).GetSafeNormal();
+	if (Direction.IsNearlyZero())
+	{
+		return;
+	}
+
+	FVector Side, Up;
+	Direction.FindBestAxisVectors(Side, Up);
+
+	Subsystem->AddLine(End, End + (Side - Direction) * ArrowSize, Color, LifeTime, Thickness);
+	Subsystem->AddLine(End, End + (-Side - Direction) * ArrowSize, Color, LifeTime, Thickness);
+}
+
+void FFarmDebugDraw::Axes(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Location, const FRotator& Rotation, float Scale, float LifeTime, float Thickness)
+{
+	UFarmDebugDrawSubsystem* Subsystem = FarmDebugDraw::GetSubsystem(System, WorldContext);
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	const FRotationMatrix Axes(Rotation);
+	Subsystem->AddLine(Location, Location + Axes.GetScaledAxis(EAxis::X) * Scale, FColor::Red, LifeTime, Thickness);
+	Subsystem->AddLine(Location, Location + Axes.GetScaledAxis(EAxis::Y) * Scale, FColor::Green, LifeTime, Thickness);
+	Subsystem->AddLine(Location, Location + Axes.GetScaledAxis(EAxis::Z) * Scale, FColor::Blue, LifeTime, Thickness);
+}
+
+#endif // FARM_DEBUG_DRAW_ENABLED
\ No newline at end of file
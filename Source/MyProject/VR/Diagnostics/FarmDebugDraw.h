@@ -0,0 +1,46 @@
+// ==================================================================
+// FarmDebugDraw.h
+// Opt-in, batched debug drawing for the farm systems
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Follows the engine's debug draw switch: compiled out of Shipping (and Test)
+#define FARM_DEBUG_DRAW_ENABLED ENABLE_DRAW_DEBUG
+
+// One console variable per system: farm.Debug.<System> 1 (or farm.Debug.All 1)
+enum class EFarmDebugSystem : uint8
+{
+	Watering,
+	Digging,
+	Seeds,
+	Hands,
+	Count
+};
+
+/**
+ * Debug shapes are tessellated into lines and queued on UFarmDebugDrawSubsystem, which submits
+ * them to the world line batcher in one call per frame. Nothing is queued unless the system's
+ * console variable is set.
+ *
+ * LifeTime 0 draws for one frame, like DrawDebug* with bPersistentLines = false and -1 life.
+ * Call through FARM_DEBUG_DRAW so the arguments are not even evaluated in Shipping.
+ */
+class MYPROJECT_API FFarmDebugDraw
+{
+public:
+	static bool IsEnabled(EFarmDebugSystem System);
+
+	static void Line(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Start, const FVector& End, const FColor& Color, float LifeTime = 0.0f, float Thickness = 0.0f);
+	static void Sphere(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Center, float Radius, int32 Segments, const FColor& Color, float LifeTime = 0.0f, float Thickness = 0.0f);
+	static void Arrow(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color, float LifeTime = 0.0f, float Thickness = 0.0f);
+	static void Axes(EFarmDebugSystem System, const UObject* WorldContext, const FVector& Location, const FRotator& Rotation, float Scale, float LifeTime = 0.0f, float Thickness = 0.0f);
+};
+
+#if FARM_DEBUG_DRAW_ENABLED
+	#define FARM_DEBUG_DRAW(System, Shape, ...) FFarmDebugDraw::Shape(EFarmDebugSystem::System, __VA_ARGS__)
+#else
+	#define FARM_DEBUG_DRAW(System, Shape, ...)
+#endif
\ No newline at end of file
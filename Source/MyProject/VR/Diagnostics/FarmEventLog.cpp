@@ -0,0 +1,190 @@
+// ==================================================================
+// FarmEventLog.cpp
+// ==================================================================
+
+#include "FarmEventLog.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Object.h"
+#include "UObject/UObjectArray.h"
+#include <atomic>
+
+namespace FarmEventLog
+{
+	struct FRing
+	{
+		FFarmEventRecord Records[FFarmEventLog::RingCapacity];
+
+		// Total records written; only the owning thread increments it
+		std::atomic<uint32> Head{0};
+		uint16 Slot = 0;
+	};
+
+	// Rings live until exit so a dump never races a thread shutting down
+	FCriticalSection RingsLock;
+	TArray<FRing*> Rings;
+
+	thread_local FRing* ThreadRing = nullptr;
+
+	const TCHAR* EventNames[] =
+	{
+		TEXT("None"),
+		TEXT("CropPlanted"),
+		TEXT("CropStateChanged"),
+		TEXT("CropNeedsWater"),
+		TEXT("CropWatered"),
+		TEXT("CropDried"),
+		TEXT("CropHarvested"),
+		TEXT("ParcelaStateChanged"),
+		TEXT("SeedPlanted"),
+		TEXT("SeedPlantFailed"),
+		TEXT("WateringCanWatered"),
+		TEXT("WateringCanEmpty"),
+		TEXT("LocomotionInput"),
+		TEXT("Grabbed"),
+		TEXT("Released"),
+		TEXT("DigStamp"),
+		TEXT("Hitch"),
+	};
+	static_assert(UE_ARRAY_COUNT(EventNames) == static_cast<SIZE_T>(EFarmEvent::Count), "EventNames out of sync with EFarmEvent");
+
+	constexpr uint32 FileMagic = 0x4C564546; // "FEVL"
+	constexpr uint32 FileVersion = 1;
+
+	void OnSystemError()
+	{
+		FFarmEventLog::DumpToFile(FPaths::ProjectLogDir() / TEXT("FarmEvents_Crash.bin"));
+	}
+
+	FRing* CreateThreadRing()
+	{
+		FRing* Ring = new FRing();
+
+		FScopeLock Lock(&RingsLock);
+		if (Rings.Num() == 0)
+		{
+			FCoreDelegates::OnHandleSystemError.AddStatic(&OnSystemError);
+		}
+
+		Ring->Slot = static_cast<uint16>(Rings.Num());
+		Rings.Add(Ring);
+		return Ring;
+	}
+
+	FAutoConsoleCommand DumpCommand(
+		TEXT("farm.EventLog.Dump"),
+		TEXT("Prints the most recent farm events. With a file name, writes the raw records to Saved/Logs/<File>.bin instead."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			if (Args.Num() > 0)
+			{
+				const FString FilePath = FPaths::ProjectLogDir() / (Args[0] + TEXT(".bin"));
+				Ar.Logf(TEXT("FarmEventLog: %s %s"), FFarmEventLog::DumpToFile(FilePath) ? TEXT("Wrote") : TEXT("Failed to write"), *FilePath);
+				return;
+			}
+
+			FFarmEventLog::DumpToOutput(Ar);
+		}));
+}
+
+void FFarmEventLog::Write(EFarmEvent Event, const UObject* Object, float A, float B, float C)
+{
+	FarmEventLog::FRing* Ring = FarmEventLog::ThreadRing;
+	if (!Ring)
+	{
+		Ring = FarmEventLog::CreateThreadRing();
+		FarmEventLog::ThreadRing = Ring;
+	}
+
+	const uint32 Head = Ring->Head.load(std::memory_order_relaxed);
+	FFarmEventRecord& Record = Ring->Records[Head & (RingCapacity - 1)];
+	Record.Cycles = FPlatformTime::Cycles64();
+	Record.Frame = static_cast<uint32>(GFrameCounter);
+	Record.Event = Event;
+	Record.ThreadSlot = Ring->Slot;
+	Record.ObjectId = Object ? Object->GetUniqueID() : 0;
+	Record.Values[0] = A;
+	Record.Values[1] = B;
+	Record.Values[2] = C;
+
+	Ring->Head.store(Head + 1, std::memory_order_release);
+}
+
+void FFarmEventLog::GetRecords(TArray<FFarmEventRecord>& OutRecords)
+{
+	OutRecords.Reset();
+
+	{
+		FScopeLock Lock(&FarmEventLog::RingsLock);
+		for (const FarmEventLog::FRing* Ring : FarmEventLog::Rings)
+		{
+			const uint32 Head = Ring->Head.load(std::memory_order_acquire);
+			const uint32 Num = FMath::Min(Head, RingCapacity);
+
+			for (uint32 Index = Head - Num; Index != Head; ++Index)
+			{
+				OutRecords.Add(Ring->Records[Index & (RingCapacity - 1)]);
+			}
+		}
+	}
+
+	OutRecords.Sort([](const FFarmEventRecord& X, const FFarmEventRecord& Y) { return X.Cycles < Y.Cycles; });
+}
+
+void FFarmEventLog::DumpToOutput(FOutputDevice& Ar, int32 MaxRecords)
+{
+	TArray<FFarmEventRecord> Records;
+	GetRecords(Records);
+
+	const int32 First = FMath::Max(0, Records.Num() - MaxRecords);
+	const uint64 LastCycles = Records.Num() > 0 ? Records.Last().Cycles : 0;
+
+	Ar.Logf(TEXT("FarmEventLog: %d of %d events (time relative to the newest)"), Records.Num() - First, Records.Num());
+
+	for (int32 Index = First; Index < Records.Num(); ++Index)
+	{
+		const FFarmEventRecord& Record = Records[Index];
+		const double AgeMs = FPlatformTime::ToMilliseconds64(LastCycles - Record.Cycles);
+
+		FString ObjectName = TEXT("-");
+		if (Record.ObjectId != 0)
+		{
+			const FUObjectItem* Item = GUObjectArray.IndexToObject(static_cast<int32>(Record.ObjectId));
+			ObjectName = Item && Item->GetObject() ? static_cast<UObject*>(Item->GetObject())->GetName() : FString::Printf(TEXT("#%u"), Record.ObjectId);
+		}
+
+		Ar.Logf(TEXT("  -%9.2f ms  frame %-8u  T%-2u  %-20s  %-32s  %.2f  %.2f  %.2f"),
+			AgeMs, Record.Frame, Record.ThreadSlot, GetEventName(Record.Event), *ObjectName,
+			Record.Values[0], Record.Values[1], Record.Values[2]);
+	}
+}
+
+bool FFarmEventLog::DumpToFile(const FString& FilePath)
+{
+	TArray<FFarmEventRecord> Records;
+	GetRecords(Records);
+
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Ar)
+	{
+		return false;
+	}
+
+	uint32 Magic = FarmEventLog::FileMagic;
+	uint32 Version = FarmEventLog::FileVersion;
+	uint32 NumRecords = static_cast<uint32>(Records.Num());
+	*Ar << Magic << Version << NumRecords;
+	Ar->Serialize(Records.GetData(), Records.Num() * sizeof(FFarmEventRecord));
+
+	return Ar->Close();
+}
+
+const TCHAR* FFarmEventLog::GetEventName(EFarmEvent Event)
+{
+	const int32 Index = static_cast<int32>(Event);
+	return Index < static_cast<int32>(UE_ARRAY_COUNT(FarmEventLog::EventNames)) ? FarmEventLog::EventNames[Index] : TEXT("Unknown");
+}
\ No newline at end of file
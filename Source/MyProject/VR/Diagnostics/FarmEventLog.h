@@ -0,0 +1,97 @@
+// ==================================================================
+// FarmEventLog.h
+// Fixed-size binary event records in per-thread ring buffers
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef FARM_EVENT_LOG_ENABLED
+	#define FARM_EVENT_LOG_ENABLED 1
+#endif
+
+/** Event ids. Append only: dumped binary logs store the raw value. */
+enum class EFarmEvent : uint16
+{
+	None,
+
+	// Crops: A = new state / value, B = growth percent
+	CropPlanted,
+	CropStateChanged,
+	CropNeedsWater,
+	CropWatered,
+	CropDried,
+	CropHarvested,
+
+	// Parcels: A = old state, B = new state
+	ParcelaStateChanged,
+
+	// Seeds: A = crop type
+	SeedPlanted,
+	SeedPlantFailed,
+
+	// Watering can: A = water left, B = capacity
+	WateringCanWatered,
+	WateringCanEmpty,
+
+	// Pawn: A/B = stick input, C = resulting yaw
+	LocomotionInput,
+
+	// Grab: A = grab type
+	Grabbed,
+	Released,
+
+	// Digging: A/B/C = location
+	DigStamp,
+
+	// Diagnostics: A = frame ms
+	Hitch,
+
+	Count
+};
+
+/** One event. Written by value, never formatted on the writing thread. */
+struct FFarmEventRecord
+{
+	uint64 Cycles = 0;      // FPlatformTime::Cycles64()
+	uint32 Frame = 0;       // GFrameCounter, truncated
+	EFarmEvent Event = EFarmEvent::None;
+	uint16 ThreadSlot = 0;  // Index of the ring that recorded it
+	uint32 ObjectId = 0;    // UObject unique id, 0 when none
+	float Values[3] = {};
+};
+static_assert(sizeof(FFarmEventRecord) == 32, "Keep farm event records at 32 bytes");
+
+/**
+ * Lock-free event log for hot paths.
+ *
+ * Each thread gets its own ring on first use (the only locked step), so a write is a few
+ * stores plus one release increment. Old records are overwritten once a ring wraps.
+ * Dump with "farm.EventLog.Dump [File]"; the log is also written to
+ * Saved/Logs/FarmEvents_Crash.bin when the engine reports a crash.
+ */
+class MYPROJECT_API FFarmEventLog
+{
+public:
+	static constexpr uint32 RingCapacity = 4096; // Per thread, power of two
+
+	static void Write(EFarmEvent Event, const UObject* Object = nullptr, float A = 0.0f, float B = 0.0f, float C = 0.0f);
+
+	// Snapshot of every ring, oldest first. Records being written during the copy may be stale.
+	static void GetRecords(TArray<FFarmEventRecord>& OutRecords);
+
+	// Human-readable dump (game thread: resolves object names)
+	static void DumpToOutput(FOutputDevice& Ar, int32 MaxRecords = 256);
+
+	// Raw dump: "FEVL", version, record count, then the records
+	static bool DumpToFile(const FString& FilePath);
+
+	static const TCHAR* GetEventName(EFarmEvent Event);
+};
+
+#if FARM_EVENT_LOG_ENABLED
+	#define FARM_EVENT(Event, ...) FFarmEventLog::Write(EFarmEvent::Event, ##__VA_ARGS__)
+#else
+	#define FARM_EVENT(Event, ...)
+#endif
\ No newline at end of file
@@ -0,0 +1,7 @@
+// ==================================================================
+// FarmLog.cpp
+// ==================================================================
+
+#include "FarmLog.h"
+
+DEFINE_LOG_CATEGORY(LogHarvestHaven);
\ No newline at end of file
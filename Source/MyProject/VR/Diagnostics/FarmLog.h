@@ -0,0 +1,24 @@
+// ==================================================================
+// FarmLog.h
+// Log category for the farm gameplay systems
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Verbosity compiled into LogHarvestHaven. Anything more verbose than this is stripped at
+ * compile time (no formatting, no branch). Override per target with
+ * GlobalDefinitions.Add("FARM_LOG_COMPILE_VERBOSITY=Log").
+ */
+#ifndef FARM_LOG_COMPILE_VERBOSITY
+	#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+		#define FARM_LOG_COMPILE_VERBOSITY Warning
+	#else
+		#define FARM_LOG_COMPILE_VERBOSITY All
+	#endif
+#endif
+
+MYPROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogHarvestHaven, Log, FARM_LOG_COMPILE_VERBOSITY);
\ No newline at end of file
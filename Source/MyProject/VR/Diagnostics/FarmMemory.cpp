@@ -0,0 +1,86 @@
+// ==================================================================
+// FarmMemory.cpp
+// ==================================================================
+
+#include "FarmMemory.h"
+
+LLM_DEFINE_TAG(Farm);
+LLM_DEFINE_TAG(Farm_Crops, TEXT("Crops"), TEXT("Farm"));
+LLM_DEFINE_TAG(Farm_Parcels, TEXT("Parcels"), TEXT("Farm"));
+LLM_DEFINE_TAG(Farm_DigHoles, TEXT("DigHoles"), TEXT("Farm"));
+LLM_DEFINE_TAG(Farm_Grabbables, TEXT("Grabbables"), TEXT("Farm"));
+LLM_DEFINE_TAG(Farm_CropCatalog, TEXT("CropCatalog"), TEXT("Farm"));
+LLM_DEFINE_TAG(Farm_SaveData, TEXT("SaveData"), TEXT("Farm"));
+
+namespace FarmMemory
+{
+	const TCHAR* SystemNames[] =
+	{
+		TEXT("Crops"),
+		TEXT("Parcels"),
+		TEXT("DigHoles"),
+		TEXT("Grabbables"),
+		TEXT("CropCatalog"),
+		TEXT("SaveData"),
+	};
+	static_assert(UE_ARRAY_COUNT(SystemNames) == static_cast<SIZE_T>(EFarmMemorySystem::Count), "SystemNames out of sync with EFarmMemorySystem");
+
+	// LLM unique names: the tag name with '_' as '/'
+	const TCHAR* TagNames[] =
+	{
+		TEXT("Farm/Crops"),
+		TEXT("Farm/Parcels"),
+		TEXT("Farm/DigHoles"),
+		TEXT("Farm/Grabbables"),
+		TEXT("Farm/CropCatalog"),
+		TEXT("Farm/SaveData"),
+	};
+	static_assert(UE_ARRAY_COUNT(TagNames) == static_cast<SIZE_T>(EFarmMemorySystem::Count), "TagNames out of sync with EFarmMemorySystem");
+}
+
+const TCHAR* FFarmMemory::GetSystemName(EFarmMemorySystem System)
+{
+	return System < EFarmMemorySystem::Count ? FarmMemory::SystemNames[static_cast<int32>(System)] : TEXT("Unknown");
+}
+
+bool FFarmMemory::IsTrackingEnabled()
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	return FLowLevelMemTracker::IsEnabled();
+#else
+	return false;
+#endif
+}
+
+int64 FFarmMemory::GetTrackedBytes(EFarmMemorySystem System)
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	if (IsTrackingEnabled() && System < EFarmMemorySystem::Count)
+	{
+		return FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default,
+			FName(FarmMemory::TagNames[static_cast<int32>(System)]), ELLMTagSet::None);
+	}
+#endif
+	return -1;
+}
+
+FFarmLLMScope::FFarmLLMScope(EFarmMemorySystem System)
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	if (System < EFarmMemorySystem::Count)
+	{
+		static const FName TagNames[] =
+		{
+			FName(FarmMemory::TagNames[0]),
+			FName(FarmMemory::TagNames[1]),
+			FName(FarmMemory::TagNames[2]),
+			FName(FarmMemory::TagNames[3]),
+			FName(FarmMemory::TagNames[4]),
+			FName(FarmMemory::TagNames[5]),
+		};
+		static_assert(UE_ARRAY_COUNT(TagNames) == static_cast<SIZE_T>(EFarmMemorySystem::Count), "TagNames out of sync with EFarmMemorySystem");
+
+		Scope.Emplace(TagNames[static_cast<int32>(System)], false, ELLMTagSet::None, ELLMTracker::Default);
+	}
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+// ==================================================================
+// FarmMemory.h
+// Low-Level Memory tracker tags for the farm systems
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "FarmMemory.generated.h"
+
+// Run with -llm (stat LLMFULL, or -llmcsv) to see these under "Farm"
+LLM_DECLARE_TAG_API(Farm, MYPROJECT_API);
+LLM_DECLARE_TAG_API(Farm_Crops, MYPROJECT_API);
+LLM_DECLARE_TAG_API(Farm_Parcels, MYPROJECT_API);
+LLM_DECLARE_TAG_API(Farm_DigHoles, MYPROJECT_API);
+LLM_DECLARE_TAG_API(Farm_Grabbables, MYPROJECT_API);
+LLM_DECLARE_TAG_API(Farm_CropCatalog, MYPROJECT_API);
+LLM_DECLARE_TAG_API(Farm_SaveData, MYPROJECT_API);
+
+// Allocations in this scope count against the system, e.g. FARM_LLM_SCOPE(Crops)
+#define FARM_LLM_SCOPE(System) LLM_SCOPE_BYTAG(Farm_##System)
+
+// One entry per Farm_* tag above
+UENUM()
+enum class EFarmMemorySystem : uint8
+{
+	Crops,
+	Parcels,
+	DigHoles,
+	Grabbables,
+	CropCatalog,
+	SaveData,
+	Count UMETA(Hidden)
+};
+
+class MYPROJECT_API FFarmMemory
+{
+public:
+	static const TCHAR* GetSystemName(EFarmMemorySystem System);
+
+	// Bytes LLM currently tracks for the system, or -1 when LLM is not running (-llm)
+	static int64 GetTrackedBytes(EFarmMemorySystem System);
+
+	static bool IsTrackingEnabled();
+};
+
+/**
+ * FARM_LLM_SCOPE for a system only known at runtime (pooled or queued classes). Count opens no
+ * scope, so the allocations stay with whatever scope the caller has open.
+ */
+class MYPROJECT_API FFarmLLMScope
+{
+public:
+	explicit FFarmLLMScope(EFarmMemorySystem System);
+
+	FFarmLLMScope(const FFarmLLMScope&) = delete;
+	FFarmLLMScope& operator=(const FFarmLLMScope&) = delete;
+
+private:
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	TOptional<FLLMScope> Scope;
+#endif
+};
+
+#define FARM_LLM_SCOPE_DYNAMIC(System) FFarmLLMScope PREPROCESSOR_JOIN(FarmLLMScope_, __LINE__)(System)
\ No newline at end of file
@@ -0,0 +1,19 @@
+// ==================================================================
+// FarmStats.cpp
+// ==================================================================
+
+#include "FarmStats.h"
+
+DEFINE_STAT(STAT_FarmCropsSeed);
+DEFINE_STAT(STAT_FarmCropsGrowing);
+DEFINE_STAT(STAT_FarmCropsMature);
+DEFINE_STAT(STAT_FarmCropsDry);
+DEFINE_STAT(STAT_FarmGrabbablesHeld);
+DEFINE_STAT(STAT_FarmSceneQueries);
+DEFINE_STAT(STAT_FarmActorScans);
+DEFINE_STAT(STAT_FarmDigStamps);
+DEFINE_STAT(STAT_FarmCropStateChanges);
+
+int64 FFarmCounters::Values[static_cast<int32>(EFarmCounter::Count)] = {};
+
+UE_TRACE_CHANNEL_DEFINE(FarmChannel);
\ No newline at end of file
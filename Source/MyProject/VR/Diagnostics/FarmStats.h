@@ -0,0 +1,80 @@
+// ==================================================================
+// FarmStats.h
+// Stat groups shared by the farm gameplay systems ("stat HarvestHaven")
+// and the "Farm" Insights trace channel (-trace=default,farm)
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+DECLARE_STATS_GROUP(TEXT("HarvestHaven"), STATGROUP_HarvestHaven, STATCAT_Advanced);
+
+// Crops currently in each growth state
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Crops Seed"), STAT_FarmCropsSeed, STATGROUP_HarvestHaven, MYPROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Crops Growing"), STAT_FarmCropsGrowing, STATGROUP_HarvestHaven, MYPROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Crops Mature"), STAT_FarmCropsMature, STATGROUP_HarvestHaven, MYPROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Crops Dry"), STAT_FarmCropsDry, STATGROUP_HarvestHaven, MYPROJECT_API);
+
+// Grabbables currently held by a hand
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Grabbables Held"), STAT_FarmGrabbablesHeld, STATGROUP_HarvestHaven, MYPROJECT_API);
+
+// Per frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scene Queries"), STAT_FarmSceneQueries, STATGROUP_HarvestHaven, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actor Scans"), STAT_FarmActorScans, STATGROUP_HarvestHaven, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Dig Stamps"), STAT_FarmDigStamps, STATGROUP_HarvestHaven, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Crop State Changes"), STAT_FarmCropStateChanges, STATGROUP_HarvestHaven, MYPROJECT_API);
+
+/**
+ * The same counters outside the stats system, so in-game panels can read them in any build.
+ * State counters hold the current value, per-frame counters a running total. Game thread only.
+ */
+enum class EFarmCounter : uint8
+{
+	CropsSeed,
+	CropsGrowing,
+	CropsMature,
+	CropsDry,
+	GrabbablesHeld,
+	SceneQueries,
+	ActorScans,
+	DigStamps,
+	CropStateChanges,
+	Count
+};
+
+struct MYPROJECT_API FFarmCounters
+{
+	static int64 Values[static_cast<int32>(EFarmCounter::Count)];
+
+	static int64 Get(EFarmCounter Counter) { return Values[static_cast<int32>(Counter)]; }
+};
+
+// Updates both the stat and the counter, e.g. FARM_COUNTER_INC(SceneQueries)
+#define FARM_COUNTER_ADD(Name, Delta) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(STAT_Farm##Name, Delta); \
+		FFarmCounters::Values[static_cast<int32>(EFarmCounter::Name)] += (Delta); \
+	} while (0)
+#define FARM_COUNTER_INC(Name) FARM_COUNTER_ADD(Name, 1)
+#define FARM_COUNTER_DEC(Name) FARM_COUNTER_ADD(Name, -1)
+
+// Farm gameplay events (plant, water, harvest, grab, state changes). Off by default.
+UE_TRACE_CHANNEL_EXTERN(FarmChannel, MYPROJECT_API);
+
+/**
+ * Cycle stat for "stat HarvestHaven". Stat scopes already show up in Insights as CPU events;
+ * where stats are compiled out (Test builds) a named CPU scope keeps the frame attributed.
+ */
+#if STATS
+	#define FARM_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+	#define FARM_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
+
+// Timing event on the Farm channel, e.g. FARM_TRACE_EVENT_SCOPE(Farm_Harvest)
+#define FARM_TRACE_EVENT_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Name, FarmChannel)
\ No newline at end of file
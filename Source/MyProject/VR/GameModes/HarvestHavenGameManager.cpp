@@ -1,5 +1,8 @@
 #include "HarvestHavenGameManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmEventBusSubsystem.h"
 
 AHarvestHavenGameManager::AHarvestHavenGameManager()
 {
@@ -47,6 +50,8 @@ void AHarvestHavenGameManager::InitializePlayerData()
 
 void AHarvestHavenGameManager::InitializeDefaultCropDatabase()
 {
+	FARM_LLM_SCOPE(CropCatalog);
+
 	// ZANAHORIA - Nivel 1
 	FCropInfo Zanahoria;
 	Zanahoria.CropType = ECultivoType::Zanahoria;
@@ -113,8 +118,8 @@ void AHarvestHavenGameManager::AddMoney(int32 Amount)
 		PlayerMoney = 0;
 	}
 
-	// Broadcast evento
-	OnMoneyChanged.Broadcast(PlayerMoney);
+	// Evento: varias ventas en el mismo frame llegan como un solo cambio
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::MoneyChanged, this, INDEX_NONE, PlayerMoney));
 
 	// Verificar si subió de nivel
 	CheckLevelProgression();
@@ -147,7 +152,7 @@ void AHarvestHavenGameManager::CheckLevelProgression()
 	// Si subió de nivel, notificar
 	if (OldLevel != PlayerLevel)
 	{
-		OnLevelChanged.Broadcast(PlayerLevel);
+		UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::LevelChanged, this, INDEX_NONE, PlayerLevel));
 		UE_LOG(LogTemp, Warning, TEXT("GameManager: LEVEL UP! %d -> %d"), OldLevel, PlayerLevel);
 	}
 }
@@ -173,8 +178,8 @@ void AHarvestHavenGameManager::AddSeeds(ECultivoType CropType, int32 Quantity)
 
 	SeedInventory[CropType] += Quantity;
 
-	// Broadcast evento
-	OnInventoryChanged.Broadcast(CropType, SeedInventory[CropType]);
+	// Evento
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::InventoryChanged, this, static_cast<int32>(CropType), SeedInventory[CropType]));
 
 	UE_LOG(LogTemp, Log, TEXT("GameManager: Added %d seeds of type %d. Total: %d"), 
 		Quantity, (int32)CropType, SeedInventory[CropType]);
@@ -196,8 +201,8 @@ bool AHarvestHavenGameManager::RemoveSeeds(ECultivoType CropType, int32 Quantity
 	// Remover semillas
 	SeedInventory[CropType] -= Quantity;
 
-	// Broadcast evento
-	OnInventoryChanged.Broadcast(CropType, SeedInventory[CropType]);
+	// Evento
+	UFarmEventBusSubsystem::Post(this, FFarmBusEvent(EFarmBusEvent::InventoryChanged, this, static_cast<int32>(CropType), SeedInventory[CropType]));
 
 	UE_LOG(LogTemp, Log, TEXT("GameManager: Removed %d seeds of type %d. Remaining: %d"), 
 		Quantity, (int32)CropType, SeedInventory[CropType]);
@@ -223,6 +228,8 @@ bool AHarvestHavenGameManager::HasSeeds(ECultivoType CropType, int32 Quantity) c
 
 bool AHarvestHavenGameManager::BuySeeds(ECultivoType CropType, int32 Quantity)
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_BuySeeds);
+
 	if (Quantity <= 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GameManager: Invalid quantity for BuySeeds: %d"), Quantity);
@@ -262,6 +269,8 @@ bool AHarvestHavenGameManager::BuySeeds(ECultivoType CropType, int32 Quantity)
 
 int32 AHarvestHavenGameManager::SellCrop(ECultivoType CropType, int32 Quantity, bool bIsDried)
 {
+	FARM_TRACE_EVENT_SCOPE(Farm_SellCrop);
+
 	if (Quantity <= 0)
 		return 0;
 
@@ -59,7 +59,8 @@ class MYPROJECT_API AHarvestHavenGameManager : public AGameModeBase
 public:
 	AHarvestHavenGameManager();
 
-	// Eventos broadcasted cuando cambian valores
+	// Eventos para Blueprint: los dispara UFarmEventBusSubsystem al final del frame,
+	// uno por frame aunque el valor cambie varias veces
 	UPROPERTY(BlueprintAssignable, Category = "Game Events")
 	FOnMoneyChanged OnMoneyChanged;
 
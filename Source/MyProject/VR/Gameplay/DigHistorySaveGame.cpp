@@ -0,0 +1,253 @@
+// ==================================================================
+// DigHistorySaveGame.cpp
+// Codec de hoyos por chunk: cuantización + deltas + RLE + Oodle
+// ==================================================================
+
+#include "DigHistorySaveGame.h"
+#include "MyProject/VR/Actors/DiggableTerrainActor.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace DigHistoryCodec
+{
+	// Resolución de cuantización
+	constexpr float PositionStep = 1.0f;	// cm
+	constexpr float SizeStep = 0.5f;		// cm
+
+	// Límites para no fiarse de un registro corrupto: un hoyo ocupa como mucho 3 varints de
+	// 5 bytes más una racha de 2 bytes para el radio y otra para la profundidad
+	constexpr int32 MaxBytesPerHole = 3 * 5 + 2 * 2;
+	constexpr int32 MaxHolesPerChunk = 1 << 20;
+
+	void WriteVarUInt(FArchive& Ar, uint32 Value)
+	{
+		do
+		{
+			uint8 Byte = Value & 0x7F;
+			Value >>= 7;
+			if (Value != 0)
+			{
+				Byte |= 0x80;
+			}
+			Ar << Byte;
+		}
+		while (Value != 0);
+	}
+
+	uint32 ReadVarUInt(FArchive& Ar)
+	{
+		uint32 Value = 0;
+		for (int32 Shift = 0; Shift < 35 && !Ar.IsError(); Shift += 7)
+		{
+			uint8 Byte = 0;
+			Ar << Byte;
+			Value |= uint32(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				break;
+			}
+		}
+		return Value;
+	}
+
+	void WriteVarInt(FArchive& Ar, int32 Value)
+	{
+		// ZigZag: deltas pequeños (positivos o negativos) ocupan un byte
+		WriteVarUInt(Ar, (uint32(Value) << 1) ^ uint32(Value >> 31));
+	}
+
+	int32 ReadVarInt(FArchive& Ar)
+	{
+		const uint32 Encoded = ReadVarUInt(Ar);
+		return int32(Encoded >> 1) ^ -int32(Encoded & 1);
+	}
+
+	void WriteRLE(FArchive& Ar, const TArray<uint8>& Values)
+	{
+		int32 Index = 0;
+		while (Index < Values.Num())
+		{
+			uint8 Value = Values[Index];
+			int32 Run = 1;
+			while (Index + Run < Values.Num() && Values[Index + Run] == Value)
+			{
+				++Run;
+			}
+
+			WriteVarUInt(Ar, Run);
+			Ar << Value;
+			Index += Run;
+		}
+	}
+
+	void ReadRLE(FArchive& Ar, int32 Count, TArray<uint8>& OutValues)
+	{
+		OutValues.Reset(Count);
+		while (OutValues.Num() < Count && !Ar.IsError())
+		{
+			const int32 Run = FMath::Min<int32>(ReadVarUInt(Ar), Count - OutValues.Num());
+			uint8 Value = 0;
+			Ar << Value;
+			if (Run <= 0)
+			{
+				Ar.SetError();
+				break;
+			}
+
+			for (int32 i = 0; i < Run; ++i)
+			{
+				OutValues.Add(Value);
+			}
+		}
+	}
+
+	uint8 QuantizeSize(float Value)
+	{
+		return (uint8)FMath::Clamp(FMath::RoundToInt(Value / SizeStep), 0, 255);
+	}
+}
+
+FIntPoint FDigHistoryCodec::GetChunkCoord(const FVector& LocalLocation, float ChunkSize)
+{
+	return FIntPoint(
+		FMath::FloorToInt(LocalLocation.X / ChunkSize),
+		FMath::FloorToInt(LocalLocation.Y / ChunkSize));
+}
+
+bool FDigHistoryCodec::EncodeChunk(const TArray<FDigHole>& LocalHoles, const FIntPoint& ChunkCoord, float ChunkSize, FDigChunkRecord& OutRecord)
+{
+	using namespace DigHistoryCodec;
+
+	OutRecord.ChunkCoord = ChunkCoord;
+	OutRecord.NumHoles = LocalHoles.Num();
+	OutRecord.UncompressedSize = 0;
+	OutRecord.Data.Reset();
+
+	if (LocalHoles.Num() == 0 || ChunkSize <= 0.0f)
+	{
+		return false;
+	}
+
+	const FVector ChunkOrigin(ChunkCoord.X * ChunkSize, ChunkCoord.Y * ChunkSize, 0.0f);
+
+	TArray<uint8> Raw;
+	FMemoryWriter Writer(Raw);
+
+	// Posiciones: deltas entre hoyos consecutivos (el swept digging deja hoyos muy juntos)
+	FIntVector Previous = FIntVector::ZeroValue;
+	TArray<uint8> Radii;
+	TArray<uint8> Depths;
+	Radii.Reserve(LocalHoles.Num());
+	Depths.Reserve(LocalHoles.Num());
+
+	for (const FDigHole& Hole : LocalHoles)
+	{
+		const FVector Offset = (Hole.Location - ChunkOrigin) / PositionStep;
+		const FIntVector Quantized(
+			FMath::RoundToInt(Offset.X),
+			FMath::RoundToInt(Offset.Y),
+			FMath::RoundToInt(Offset.Z));
+
+		WriteVarInt(Writer, Quantized.X - Previous.X);
+		WriteVarInt(Writer, Quantized.Y - Previous.Y);
+		WriteVarInt(Writer, Quantized.Z - Previous.Z);
+		Previous = Quantized;
+
+		Radii.Add(QuantizeSize(Hole.Radius));
+		Depths.Add(QuantizeSize(Hole.Depth));
+	}
+
+	WriteRLE(Writer, Radii);
+	WriteRLE(Writer, Depths);
+
+	// Oodle: solo guardar comprimido si realmente ocupa menos
+	const int32 RawSize = Raw.Num();
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, RawSize);
+	OutRecord.Data.SetNumUninitialized(CompressedSize);
+
+	if (FCompression::CompressMemory(NAME_Oodle, OutRecord.Data.GetData(), CompressedSize, Raw.GetData(), RawSize)
+		&& CompressedSize < RawSize)
+	{
+		OutRecord.Data.SetNum(CompressedSize);
+		OutRecord.UncompressedSize = RawSize;
+	}
+	else
+	{
+		OutRecord.Data = MoveTemp(Raw);
+	}
+
+	return true;
+}
+
+bool FDigHistoryCodec::DecodeChunk(const FDigChunkRecord& Record, float ChunkSize, TArray<FDigHole>& OutLocalHoles)
+{
+	using namespace DigHistoryCodec;
+
+	OutLocalHoles.Reset();
+
+	if (Record.NumHoles <= 0 || Record.Data.Num() == 0 || ChunkSize <= 0.0f)
+	{
+		return false;
+	}
+
+	// El tamaño viene del disco: acotarlo antes de reservar memoria
+	if (Record.NumHoles > MaxHolesPerChunk || Record.UncompressedSize < 0
+		|| Record.UncompressedSize > Record.NumHoles * MaxBytesPerHole)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DigHistory: Corrupt chunk (%d, %d): %d holes, %d bytes uncompressed"),
+			Record.ChunkCoord.X, Record.ChunkCoord.Y, Record.NumHoles, Record.UncompressedSize);
+		return false;
+	}
+
+	TArray<uint8> Raw;
+	if (Record.UncompressedSize > 0)
+	{
+		Raw.SetNumUninitialized(Record.UncompressedSize);
+		if (!FCompression::UncompressMemory(NAME_Oodle, Raw.GetData(), Raw.Num(), Record.Data.GetData(), Record.Data.Num()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("DigHistory: Failed to decompress chunk (%d, %d)"),
+				Record.ChunkCoord.X, Record.ChunkCoord.Y);
+			return false;
+		}
+	}
+	else
+	{
+		Raw = Record.Data;
+	}
+
+	FMemoryReader Reader(Raw);
+	const FVector ChunkOrigin(Record.ChunkCoord.X * ChunkSize, Record.ChunkCoord.Y * ChunkSize, 0.0f);
+
+	TArray<FVector> Locations;
+	Locations.Reserve(Record.NumHoles);
+
+	FIntVector Current = FIntVector::ZeroValue;
+	for (int32 i = 0; i < Record.NumHoles && !Reader.IsError(); ++i)
+	{
+		Current.X += ReadVarInt(Reader);
+		Current.Y += ReadVarInt(Reader);
+		Current.Z += ReadVarInt(Reader);
+		Locations.Add(ChunkOrigin + FVector(Current) * PositionStep);
+	}
+
+	TArray<uint8> Radii;
+	TArray<uint8> Depths;
+	ReadRLE(Reader, Record.NumHoles, Radii);
+	ReadRLE(Reader, Record.NumHoles, Depths);
+
+	if (Reader.IsError() || Locations.Num() != Record.NumHoles || Radii.Num() != Record.NumHoles || Depths.Num() != Record.NumHoles)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DigHistory: Corrupt chunk (%d, %d), skipping"),
+			Record.ChunkCoord.X, Record.ChunkCoord.Y);
+		return false;
+	}
+
+	OutLocalHoles.Reserve(Record.NumHoles);
+	for (int32 i = 0; i < Record.NumHoles; ++i)
+	{
+		OutLocalHoles.Add(FDigHole(Locations[i], Radii[i] * SizeStep, Depths[i] * SizeStep));
+	}
+
+	return true;
+}
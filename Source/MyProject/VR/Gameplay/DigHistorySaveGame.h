@@ -0,0 +1,83 @@
+// ==================================================================
+// DigHistorySaveGame.h
+// Persistencia comprimida de los hoyos excavados en el terreno
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "DigHistorySaveGame.generated.h"
+
+struct FDigHole;
+
+/**
+ * Hoyos de un chunk del terreno, codificados como deltas cuantizados
+ * respecto al origen del chunk y comprimidos con Oodle.
+ */
+USTRUCT()
+struct FDigChunkRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FIntPoint ChunkCoord = FIntPoint::ZeroValue;
+
+	UPROPERTY()
+	int32 NumHoles = 0;
+
+	// Tamaño del stream antes de comprimir (0 si Data no está comprimido)
+	UPROPERTY()
+	int32 UncompressedSize = 0;
+
+	UPROPERTY()
+	TArray<uint8> Data;
+};
+
+/**
+ * Historial de excavación de un ADiggableTerrainActor
+ */
+USTRUCT()
+struct FDigTerrainRecord
+{
+	GENERATED_BODY()
+
+	// Tamaño de chunk con el que se codificó (cm, espacio local del terreno)
+	UPROPERTY()
+	float ChunkSize = 0.0f;
+
+	UPROPERTY()
+	TArray<FDigChunkRecord> Chunks;
+};
+
+UCLASS()
+class MYPROJECT_API UDigHistorySaveGame : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 CurrentVersion = 1;
+
+	UPROPERTY()
+	int32 Version = CurrentVersion;
+
+	// Clave: PersistenceId del terreno
+	UPROPERTY()
+	TMap<FString, FDigTerrainRecord> Terrains;
+};
+
+/**
+ * Codificación de hoyos por chunk:
+ * - Posición local cuantizada a 1 cm, delta entre hoyos consecutivos (varint zigzag)
+ * - Radio y profundidad cuantizados a 0.5 cm con RLE (casi siempre constantes por herramienta)
+ * - Todo el stream comprimido con Oodle
+ */
+struct MYPROJECT_API FDigHistoryCodec
+{
+	// LocalHoles: posiciones en espacio local del terreno
+	static bool EncodeChunk(const TArray<FDigHole>& LocalHoles, const FIntPoint& ChunkCoord, float ChunkSize, FDigChunkRecord& OutRecord);
+
+	static bool DecodeChunk(const FDigChunkRecord& Record, float ChunkSize, TArray<FDigHole>& OutLocalHoles);
+
+	static FIntPoint GetChunkCoord(const FVector& LocalLocation, float ChunkSize);
+};
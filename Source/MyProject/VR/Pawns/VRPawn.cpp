@@ -3,6 +3,10 @@
 #include "MyProject/VR/Components/VRInteractionComponent.h"
 #include "MyProject/VR/Components/VRHandAnimationComponent.h"
 #include "MyProject/VR/Components/VRInputComponent.h"
+#include "MyProject/VR/Components/VRSessionRecorderComponent.h"
+#include "MyProject/VR/Components/VRPerfPanelComponent.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Engine/LocalPlayer.h"
@@ -10,6 +14,8 @@
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
+DECLARE_CYCLE_STAT(TEXT("VR Pawn Tick"), STAT_FarmVRPawnTick, STATGROUP_HarvestHaven);
+
 AVRPawn::AVRPawn()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -85,12 +91,21 @@ void AVRPawn::SetupComponentHierarchy()
 	InteractionComponent = CreateDefaultSubobject<UVRInteractionComponent>(TEXT("InteractionComponent"));
 	HandAnimationComponent = CreateDefaultSubobject<UVRHandAnimationComponent>(TEXT("HandAnimationComponent"));
 	VRInputComponent = CreateDefaultSubobject<UVRInputComponent>(TEXT("VRInputComponent"));
+	SessionRecorderComponent = CreateDefaultSubobject<UVRSessionRecorderComponent>(TEXT("SessionRecorderComponent"));
+
+	// Perf panel (oculto hasta IA_Menu_Toggle_Left), encima del mando izquierdo mirando al jugador
+	PerfPanel = CreateDefaultSubobject<UVRPerfPanelComponent>(TEXT("PerfPanel"));
+	PerfPanel->SetupAttachment(MotionControllerLeftGrip);
+	PerfPanel->SetRelativeLocation(FVector(0.0f, 0.0f, 12.0f));
+	PerfPanel->SetRelativeRotation(FRotator(0.0f, 180.0f, 0.0f));
 }
 
 void AVRPawn::BeginPlay()
 {
 	Super::BeginPlay();
 
+	FString ReplaySessionName;
+
 	if (UHeadMountedDisplayFunctionLibrary::IsHeadMountedDisplayEnabled())
 	{
 		UHeadMountedDisplayFunctionLibrary::SetTrackingOrigin(EHMDTrackingOrigin::Stage);
@@ -104,10 +119,41 @@ void AVRPawn::BeginPlay()
 			bUseSmoothLocomotion ? TEXT("SMOOTH") : TEXT("TELEPORT"));
 		UE_LOG(LogTemp, Warning, TEXT("Movement Speed: %.0f cm/s"), MovementSpeed);
 	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("VRReplay="), ReplaySessionName))
+	{
+		// Headless benchmark: recorded poses and input stand in for the headset
+		InitializeVRComponents();
+		UE_LOG(LogTemp, Warning, TEXT("VRPawn: HMD not detected, replaying VR session %s"), *ReplaySessionName);
+	}
 	else
 	{
 		UE_LOG(LogTemp, Warning, TEXT("VRPawn: HMD not detected, VR features disabled"));
 	}
+
+	InitializeSessionRecorder();
+}
+
+void AVRPawn::InitializeSessionRecorder()
+{
+	if (!SessionRecorderComponent)
+	{
+		return;
+	}
+
+	SessionRecorderComponent->SetInputComponent(VRInputComponent);
+	SessionRecorderComponent->SetTrackedComponents(Camera, {
+		MotionControllerRightAim, MotionControllerRightGrip, MotionControllerLeftAim, MotionControllerLeftGrip });
+
+	FString SessionName;
+	if (FParse::Value(FCommandLine::Get(), TEXT("VRReplay="), SessionName))
+	{
+		SessionRecorderComponent->bExitWhenReplayFinishes = FParse::Param(FCommandLine::Get(), TEXT("VRReplayExit"));
+		SessionRecorderComponent->StartReplay(SessionName);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("VRRecord="), SessionName))
+	{
+		SessionRecorderComponent->StartRecording(SessionName);
+	}
 }
 
 void AVRPawn::InitializeVRComponents()
@@ -190,6 +236,8 @@ UEnhancedInputLocalPlayerSubsystem* AVRPawn::GetEnhancedInputSubsystem() const
 
 void AVRPawn::Tick(float DeltaTime)
 {
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmVRPawnTick);
+
 	Super::Tick(DeltaTime);
 	
 	// Visualizar radio de agarre
@@ -256,9 +304,6 @@ FVector AVRPawn::GetCameraRelativeMovementDirection(FVector2D Input) const
 		return FVector::ForwardVector;
 	}
 
-	// DEBUG: Ver valores de input
-	UE_LOG(LogTemp, Warning, TEXT("Input RAW: X=%.2f Y=%.2f"), Input.X, Input.Y);
-
 	// Obtener rotación de la cámara (solo Yaw, ignorar Pitch y Roll)
 	FRotator CameraRotation = Camera->GetComponentRotation();
 	CameraRotation.Pitch = 0.0f;
@@ -276,9 +321,8 @@ FVector AVRPawn::GetCameraRelativeMovementDirection(FVector2D Input) const
 	MovementDirection.Z = 0.0f;
 	MovementDirection.Normalize();
 
-	// DEBUG: Ver dirección resultante
-	UE_LOG(LogTemp, Warning, TEXT("Movement Direction: X=%.2f Y=%.2f Z=%.2f"), 
-		MovementDirection.X, MovementDirection.Y, MovementDirection.Z);
+	// Input crudo y yaw resultante, sin formatear cada frame ("farm.EventLog.Dump" para verlos)
+	FARM_EVENT(LocomotionInput, this, static_cast<float>(Input.X), static_cast<float>(Input.Y), static_cast<float>(CameraRotation.Yaw));
 
 	return MovementDirection;
 }
\ No newline at end of file
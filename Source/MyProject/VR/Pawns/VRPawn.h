@@ -59,6 +59,13 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR System Components")
 	UVRInputComponent* VRInputComponent;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR System Components")
+	class UVRSessionRecorderComponent* SessionRecorderComponent;
+
+	// Panel de rendimiento en la muñeca izquierda (IA_Menu_Toggle_Left)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR Debug")
+	class UVRPerfPanelComponent* PerfPanel;
+
 	// Controllers
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR Controllers")
 	UMotionControllerComponent* MotionControllerRightAim;
@@ -162,6 +169,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "VR Components")
 	UVRInputComponent* GetVRInputComponent() const { return VRInputComponent; }
 
+	UFUNCTION(BlueprintPure, Category = "VR Components")
+	UVRSessionRecorderComponent* GetSessionRecorderComponent() const { return SessionRecorderComponent; }
+
 	// VR Hardware Getters
 	UFUNCTION(BlueprintPure, Category = "VR Hardware")
 	UMotionControllerComponent* GetRightGripController() const { return MotionControllerRightGrip; }
@@ -178,6 +188,7 @@ public:
 private:
 	void SetupComponentHierarchy();
 	void InitializeVRComponents();
+	void InitializeSessionRecorder();
 	void SetupInputMappingContexts();
 	class UEnhancedInputLocalPlayerSubsystem* GetEnhancedInputSubsystem() const;
 };
\ No newline at end of file
@@ -0,0 +1,269 @@
+// ==================================================================
+// FarmActorPoolSubsystem.cpp
+// ==================================================================
+
+#include "FarmActorPoolSubsystem.h"
+#include "FarmEventBusSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Actor Pool Acquire"), STAT_FarmPoolAcquire, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Actor Pool Release"), STAT_FarmPoolRelease, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Actors Idle"), STAT_FarmPooledActorsIdle, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Misses (spawned)"), STAT_FarmPoolMisses, STATGROUP_HarvestHaven);
+
+UFarmActorPoolSubsystem* UFarmActorPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmActorPoolSubsystem>() : nullptr;
+}
+
+AActor* UFarmActorPoolSubsystem::Acquire(const UObject* WorldContextObject, TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner)
+{
+	if (UFarmActorPoolSubsystem* Pool = Get(WorldContextObject))
+	{
+		return Pool->AcquireActor(Class, Transform, Owner);
+	}
+
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || !Class)
+	{
+		return nullptr;
+	}
+
+	// No pool, so no per-class tag: the spawn is counted under the caller's FARM_LLM_SCOPE
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Owner;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return World->SpawnActor<AActor>(Class, Transform, SpawnParams);
+}
+
+void UFarmActorPoolSubsystem::Release(AActor* Actor)
+{
+	if (UFarmActorPoolSubsystem* Pool = Get(Actor))
+	{
+		Pool->ReleaseActor(Actor);
+	}
+	else if (IsValid(Actor))
+	{
+		Actor->Destroy();
+	}
+}
+
+bool UFarmActorPoolSubsystem::IsPooled(const AActor* Actor)
+{
+	const UFarmActorPoolSubsystem* Pool = Get(Actor);
+	return Pool && Pool->PooledActors.Contains(TObjectKey<AActor>(Actor));
+}
+
+AActor* UFarmActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmPoolAcquire);
+
+	UWorld* World = GetWorld();
+	if (!Class || !World)
+	{
+		return nullptr;
+	}
+
+	FActorPool* Pool = bEnabled ? ActorPools.Find(Class.Get()) : nullptr;
+	if (Pool)
+	{
+		while (Pool->Idle.Num() > 0)
+		{
+			AActor* Actor = Pool->Idle.Pop(EAllowShrinking::No).Get();
+			DEC_DWORD_STAT(STAT_FarmPooledActorsIdle);
+
+			// Destroyed while idle (level streaming, editor tools)
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			PooledActors.Remove(TObjectKey<AActor>(Actor));
+			ActivateActor(Actor, Transform, Owner);
+
+			if (IFarmPoolable* Poolable = Cast<IFarmPoolable>(Actor))
+			{
+				Poolable->OnAcquiredFromPool();
+			}
+
+			return Actor;
+		}
+	}
+
+	++NumMisses;
+	INC_DWORD_STAT(STAT_FarmPoolMisses);
+
+	FARM_LLM_SCOPE_DYNAMIC(Pool ? Pool->MemorySystem : EFarmMemorySystem::Count);
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Owner;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return World->SpawnActor<AActor>(Class, Transform, SpawnParams);
+}
+
+void UFarmActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmPoolRelease);
+
+	if (!IsValid(Actor) || PooledActors.Contains(TObjectKey<AActor>(Actor)))
+	{
+		return;
+	}
+
+	// Whatever the actor posted this frame is about the actor before it is reset or destroyed
+	if (UFarmEventBusSubsystem* EventBus = UFarmEventBusSubsystem::Get(this))
+	{
+		EventBus->FlushSource(Actor);
+	}
+
+	const UWorld* World = GetWorld();
+	FActorPool* Pool = bEnabled && World && !World->bIsTearingDown ? &FindOrAddPool(Actor->GetClass()) : nullptr;
+	if (!Pool || Pool->Idle.Num() >= Pool->MaxPooled)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	// The hooks run while the actor is still active so a held actor can be released normally
+	if (IFarmPoolable* Poolable = Cast<IFarmPoolable>(Actor))
+	{
+		Poolable->OnReturnedToPool();
+	}
+
+	DeactivateActor(Actor);
+
+	PooledActors.Add(TObjectKey<AActor>(Actor));
+	Pool->Idle.Add(Actor);
+	INC_DWORD_STAT(STAT_FarmPooledActorsIdle);
+}
+
+void UFarmActorPoolSubsystem::Prewarm(TSubclassOf<AActor> Class, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!Class || !World || !bEnabled)
+	{
+		return;
+	}
+
+	FActorPool& Pool = FindOrAddPool(Class.Get());
+	const int32 NumToSpawn = FMath::Min(Count, Pool.MaxPooled) - Pool.Idle.Num();
+
+	// Prewarm runs at BeginPlay with no caller scope, so the pool's own tag is all there is
+	FARM_LLM_SCOPE_DYNAMIC(Pool.MemorySystem);
+
+	for (int32 Index = 0; Index < NumToSpawn; ++Index)
+	{
+		// Deferred so IsPooled() is already true when the actor's BeginPlay runs
+		AActor* Actor = World->SpawnActorDeferred<AActor>(Class, FTransform::Identity, nullptr, nullptr,
+			ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!Actor)
+		{
+			break;
+		}
+
+		PooledActors.Add(TObjectKey<AActor>(Actor));
+		Actor->FinishSpawning(FTransform::Identity);
+
+		DeactivateActor(Actor);
+		Pool.Idle.Add(Actor);
+		INC_DWORD_STAT(STAT_FarmPooledActorsIdle);
+	}
+
+	UE_LOG(LogHarvestHaven, Verbose, TEXT("ActorPool: %s prewarmed to %d"), *Class->GetName(), Pool.Idle.Num());
+}
+
+int32 UFarmActorPoolSubsystem::GetIdleCount(TSubclassOf<AActor> Class) const
+{
+	const FActorPool* Pool = Class ? ActorPools.Find(Class.Get()) : nullptr;
+	return Pool ? Pool->Idle.Num() : 0;
+}
+
+void UFarmActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (const FFarmActorPoolSettings& Settings : Pools)
+	{
+		UClass* Class = Settings.ActorClass.LoadSynchronous();
+		if (!Class)
+		{
+			UE_LOG(LogHarvestHaven, Warning, TEXT("ActorPool: Cannot load %s"), *Settings.ActorClass.ToString());
+			continue;
+		}
+
+		FActorPool& Pool = FindOrAddPool(Class);
+		if (Settings.MaxPooled > 0)
+		{
+			Pool.MaxPooled = Settings.MaxPooled;
+		}
+		Pool.MemorySystem = Settings.MemorySystem;
+
+		Prewarm(Class, Settings.PrewarmCount);
+	}
+}
+
+void UFarmActorPoolSubsystem::Deinitialize()
+{
+	for (const TPair<TObjectKey<UClass>, FActorPool>& Pair : ActorPools)
+	{
+		DEC_DWORD_STAT_BY(STAT_FarmPooledActorsIdle, Pair.Value.Idle.Num());
+	}
+
+	ActorPools.Reset();
+	PooledActors.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UFarmActorPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UFarmActorPoolSubsystem::FActorPool& UFarmActorPoolSubsystem::FindOrAddPool(UClass* Class)
+{
+	FActorPool* Pool = ActorPools.Find(Class);
+	if (!Pool)
+	{
+		Pool = &ActorPools.Add(Class);
+		Pool->MaxPooled = DefaultMaxPooled;
+	}
+	return *Pool;
+}
+
+void UFarmActorPoolSubsystem::ActivateActor(AActor* Actor, const FTransform& Transform, AActor* Owner)
+{
+	Actor->SetOwner(Owner);
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+	Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+	// Simulation comes back as the class default sets it up
+	UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+	const UPrimitiveComponent* DefaultRoot = Cast<UPrimitiveComponent>(Actor->GetClass()->GetDefaultObject<AActor>()->GetRootComponent());
+	if (Root && DefaultRoot && DefaultRoot->BodyInstance.bSimulatePhysics)
+	{
+		Root->SetSimulatePhysics(true);
+	}
+}
+
+void UFarmActorPoolSubsystem::DeactivateActor(AActor* Actor)
+{
+	// Idle actors stay where they were released: hidden and without collision they cost no more
+	// than a parked transform, and moving them would be one more transform update per release
+	// (the ResetPhysics teleport on activation clears any velocity left over)
+	UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+	if (Root && Root->IsSimulatingPhysics())
+	{
+		Root->SetSimulatePhysics(false);
+	}
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->SetOwner(nullptr);
+}
\ No newline at end of file
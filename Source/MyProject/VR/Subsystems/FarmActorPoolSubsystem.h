@@ -0,0 +1,134 @@
+// ==================================================================
+// FarmActorPoolSubsystem.h
+// Reuses crops, seeds and other short-lived farm actors instead of spawning them
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "UObject/ObjectKey.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "FarmActorPoolSubsystem.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UFarmPoolable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Reset hooks for pooled actors. The pool itself hides the actor and turns off its collision,
+ * tick and physics; these cover the actor's own gameplay state and registrations.
+ */
+class MYPROJECT_API IFarmPoolable
+{
+	GENERATED_BODY()
+
+public:
+	// Placed and visible again, about to be handed out
+	virtual void OnAcquiredFromPool() {}
+
+	// Going back to the pool: clear gameplay state and stop any registered work
+	virtual void OnReturnedToPool() {}
+};
+
+USTRUCT()
+struct FFarmActorPoolSettings
+{
+	GENERATED_BODY()
+
+	// Pools are per exact class, so list the Blueprint classes the game actually spawns
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	TSoftClassPtr<AActor> ActorClass;
+
+	// Spawned hidden when the world begins play
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	int32 PrewarmCount = 0;
+
+	// Released actors beyond this are destroyed (0 = DefaultMaxPooled)
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	int32 MaxPooled = 0;
+
+	// LLM tag for the pool's spawns (prewarm and misses); Count leaves them to the caller's scope
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	EFarmMemorySystem MemorySystem = EFarmMemorySystem::Count;
+};
+
+/**
+ * Per-class actor pools for the planting and harvesting loops.
+ *
+ * AcquireActor hands out an idle actor of the class (spawning one only when the pool is empty)
+ * and ReleaseActor takes it back instead of destroying it. Classes listed in Pools are
+ * prewarmed when the world begins play; any other class gets a pool the first time one of its
+ * actors is released. Actors implementing IFarmPoolable get reset hooks.
+ *
+ * Actors spawned into a pool still run BeginPlay, with IsPooled() already true, so they can
+ * skip the work they only do while active. Pool misses show up under "stat HarvestHaven".
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Off: AcquireActor always spawns and ReleaseActor always destroys
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	bool bEnabled = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	int32 DefaultMaxPooled = 64;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Pool")
+	TArray<FFarmActorPoolSettings> Pools;
+
+	static UFarmActorPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// Call-site helpers: go through the pool when there is one, else plain SpawnActor / Destroy
+	static AActor* Acquire(const UObject* WorldContextObject, TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner = nullptr);
+	static void Release(AActor* Actor);
+
+	template<typename T>
+	static T* Acquire(const UObject* WorldContextObject, TSubclassOf<T> Class, const FTransform& Transform, AActor* Owner = nullptr)
+	{
+		return Cast<T>(Acquire(WorldContextObject, TSubclassOf<AActor>(Class.Get()), Transform, Owner));
+	}
+
+	// True while Actor sits idle in a pool, including during BeginPlay of a prewarmed actor
+	static bool IsPooled(const AActor* Actor);
+
+	AActor* AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner = nullptr);
+	void ReleaseActor(AActor* Actor);
+
+	// Spawns idle actors until the pool for Class holds Count
+	void Prewarm(TSubclassOf<AActor> Class, int32 Count);
+
+	int32 GetIdleCount(TSubclassOf<AActor> Class) const;
+
+	// Acquires that had to spawn because the pool was empty, since the world started
+	int32 GetMissCount() const { return NumMisses; }
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FActorPool
+	{
+		TArray<TWeakObjectPtr<AActor>> Idle;
+		int32 MaxPooled = 0;
+		EFarmMemorySystem MemorySystem = EFarmMemorySystem::Count;
+	};
+
+	FActorPool& FindOrAddPool(UClass* Class);
+	void ActivateActor(AActor* Actor, const FTransform& Transform, AActor* Owner);
+	void DeactivateActor(AActor* Actor);
+
+	TMap<TObjectKey<UClass>, FActorPool> ActorPools;
+	TSet<TObjectKey<AActor>> PooledActors;
+
+	int32 NumMisses = 0;
+};
\ No newline at end of file
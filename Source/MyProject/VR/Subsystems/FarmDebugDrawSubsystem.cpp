@@ -0,0 +1,64 @@
+// ==================================================================
+// FarmDebugDrawSubsystem.cpp
+// ==================================================================
+
+#include "FarmDebugDrawSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmDebugDraw.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Debug Draw Submit"), STAT_FarmDebugDrawSubmit, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debug Lines Submitted"), STAT_FarmDebugLinesSubmitted, STATGROUP_HarvestHaven);
+
+UFarmDebugDrawSubsystem* UFarmDebugDrawSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmDebugDrawSubsystem>() : nullptr;
+}
+
+bool UFarmDebugDrawSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return FARM_DEBUG_DRAW_ENABLED && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UFarmDebugDrawSubsystem::AddLine(const FVector& Start, const FVector& End, const FColor& Color, float LifeTime, float Thickness)
+{
+	// Same split as DrawDebugLine: anything that outlives the frame goes to the persistent batcher
+	TArray<FBatchedLine>& Lines = LifeTime > 0.0f ? PendingPersistentLines : PendingLines;
+	Lines.Emplace(Start, End, FLinearColor(Color), LifeTime, Thickness, SDPG_World);
+}
+
+void UFarmDebugDrawSubsystem::Tick(float DeltaTime)
+{
+	if (PendingLines.Num() == 0 && PendingPersistentLines.Num() == 0)
+	{
+		return;
+	}
+
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmDebugDrawSubmit);
+	INC_DWORD_STAT_BY(STAT_FarmDebugLinesSubmitted, PendingLines.Num() + PendingPersistentLines.Num());
+
+	UWorld* World = GetWorld();
+	if (PendingLines.Num() > 0)
+	{
+		if (ULineBatchComponent* LineBatcher = World->GetLineBatcher(UWorld::ELineBatcherType::World))
+		{
+			LineBatcher->DrawLines(PendingLines);
+		}
+		PendingLines.Reset();
+	}
+
+	if (PendingPersistentLines.Num() > 0)
+	{
+		if (ULineBatchComponent* LineBatcher = World->GetLineBatcher(UWorld::ELineBatcherType::WorldPersistent))
+		{
+			LineBatcher->DrawLines(PendingPersistentLines);
+		}
+		PendingPersistentLines.Reset();
+	}
+}
+
+TStatId UFarmDebugDrawSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmDebugDrawSubsystem, STATGROUP_Tickables);
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+// ==================================================================
+// FarmDebugDrawSubsystem.h
+// Collects farm debug lines and submits them once per frame
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/LineBatchComponent.h"
+#include "FarmDebugDrawSubsystem.generated.h"
+
+/**
+ * Line buffer behind FFarmDebugDraw. Only created in builds with debug drawing.
+ */
+UCLASS()
+class MYPROJECT_API UFarmDebugDrawSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UFarmDebugDrawSubsystem* Get(const UObject* WorldContextObject);
+
+	void AddLine(const FVector& Start, const FVector& End, const FColor& Color, float LifeTime, float Thickness);
+
+	int32 GetPendingLineCount() const { return PendingLines.Num() + PendingPersistentLines.Num(); }
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	// One-frame lines, and lines with a LifeTime (the World batcher is cleared every frame)
+	TArray<FBatchedLine> PendingLines;
+	TArray<FBatchedLine> PendingPersistentLines;
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+// ==================================================================
+// FarmDigHistorySubsystem.cpp
+// ==================================================================
+
+#include "FarmDigHistorySubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Gameplay/DigHistorySaveGame.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+UFarmDigHistorySubsystem* UFarmDigHistorySubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmDigHistorySubsystem>() : nullptr;
+}
+
+bool UFarmDigHistorySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFarmDigHistorySubsystem::Deinitialize()
+{
+	// Saves still being written finish on their own; they hold their slot through the callback
+	Slots.Reset();
+
+	Super::Deinitialize();
+}
+
+void UFarmDigHistorySubsystem::LoadSlot(const FString& SlotName, FOnDigHistorySlotLoaded&& OnLoaded)
+{
+	if (const TSharedRef<FSlot>* Existing = Slots.Find(SlotName))
+	{
+		if ((*Existing)->SaveGame.IsValid())
+		{
+			OnLoaded.ExecuteIfBound((*Existing)->SaveGame.Get());
+		}
+		else
+		{
+			(*Existing)->PendingLoads.Add(MoveTemp(OnLoaded));
+		}
+		return;
+	}
+
+	TSharedRef<FSlot> Slot = MakeShared<FSlot>();
+	Slot->PendingLoads.Add(MoveTemp(OnLoaded));
+	Slots.Add(SlotName, Slot);
+
+	UGameplayStatics::AsyncLoadGameFromSlot(SlotName, 0, FAsyncLoadGameFromSlotDelegate::CreateLambda(
+		[Slot](const FString& LoadedSlotName, const int32 UserIndex, USaveGame* Loaded)
+		{
+			FARM_LLM_SCOPE(SaveData);
+
+			UDigHistorySaveGame* SaveGame = Cast<UDigHistorySaveGame>(Loaded);
+			if (!SaveGame || SaveGame->Version != UDigHistorySaveGame::CurrentVersion)
+			{
+				if (Loaded)
+				{
+					UE_LOG(LogHarvestHaven, Warning, TEXT("DigHistory: Slot %s is outdated, starting empty"), *LoadedSlotName);
+				}
+				SaveGame = Cast<UDigHistorySaveGame>(UGameplayStatics::CreateSaveGameObject(UDigHistorySaveGame::StaticClass()));
+			}
+
+			Slot->SaveGame.Reset(SaveGame);
+
+			TArray<FOnDigHistorySlotLoaded> PendingLoads = MoveTemp(Slot->PendingLoads);
+			for (FOnDigHistorySlotLoaded& PendingLoad : PendingLoads)
+			{
+				PendingLoad.ExecuteIfBound(SaveGame);
+			}
+
+			// A save asked for while loading would have written an empty slot; it goes out now
+			if (Slot->bSaveAgain)
+			{
+				StartSave(LoadedSlotName, Slot);
+			}
+		}));
+}
+
+UDigHistorySaveGame* UFarmDigHistorySubsystem::FindSlot(const FString& SlotName) const
+{
+	const TSharedRef<FSlot>* Slot = Slots.Find(SlotName);
+	return Slot ? (*Slot)->SaveGame.Get() : nullptr;
+}
+
+void UFarmDigHistorySubsystem::SaveSlot(const FString& SlotName)
+{
+	const TSharedRef<FSlot>* Slot = Slots.Find(SlotName);
+	if (!Slot)
+	{
+		return;
+	}
+
+	if ((*Slot)->bSaving || !(*Slot)->SaveGame.IsValid())
+	{
+		(*Slot)->bSaveAgain = true;
+		return;
+	}
+
+	StartSave(SlotName, *Slot);
+}
+
+void UFarmDigHistorySubsystem::StartSave(const FString& SlotName, const TSharedRef<FSlot>& Slot)
+{
+	Slot->bSaving = true;
+	Slot->bSaveAgain = false;
+
+	// The object is serialized here on the game thread; only the file write runs in the background
+	UGameplayStatics::AsyncSaveGameToSlot(Slot->SaveGame.Get(), SlotName, 0, FAsyncSaveGameToSlotDelegate::CreateLambda(
+		[Slot](const FString& SavedSlotName, const int32 UserIndex, bool bSuccess)
+		{
+			Slot->bSaving = false;
+
+			if (!bSuccess)
+			{
+				UE_LOG(LogHarvestHaven, Warning, TEXT("DigHistory: Failed to save slot %s"), *SavedSlotName);
+			}
+
+			if (Slot->bSaveAgain)
+			{
+				StartSave(SavedSlotName, Slot);
+			}
+		}));
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+// ==================================================================
+// FarmDigHistorySubsystem.h
+// Dig history save slots kept in memory, read and written off the game thread
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/StrongObjectPtr.h"
+#include "FarmDigHistorySubsystem.generated.h"
+
+class UDigHistorySaveGame;
+
+DECLARE_DELEGATE_OneParam(FOnDigHistorySlotLoaded, UDigHistorySaveGame*);
+
+/**
+ * One UDigHistorySaveGame per slot, shared by every terrain of the world that persists into it.
+ *
+ * Terrains update their record in the in-memory slot and ask for a save; the file is only read
+ * with AsyncLoadGameFromSlot and written with AsyncSaveGameToSlot, so neither the autosave nor
+ * EndPlay blocks the game thread on disk. Saves to one slot never overlap: a save requested
+ * while the previous one is still being written goes out when it finishes, with the slot's
+ * contents at that point.
+ */
+UCLASS()
+class MYPROJECT_API UFarmDigHistorySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UFarmDigHistorySubsystem* Get(const UObject* WorldContextObject);
+
+	// OnLoaded gets the slot once it is in memory (right away if it already is); a missing or
+	// outdated file gives an empty slot
+	void LoadSlot(const FString& SlotName, FOnDigHistorySlotLoaded&& OnLoaded);
+
+	// The slot, or null while it is still loading
+	UDigHistorySaveGame* FindSlot(const FString& SlotName) const;
+
+	// Writes the slot's current contents in the background
+	void SaveSlot(const FString& SlotName);
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// Shared with the async callbacks, which can outlive the subsystem at world teardown
+	struct FSlot
+	{
+		TStrongObjectPtr<UDigHistorySaveGame> SaveGame;
+		TArray<FOnDigHistorySlotLoaded> PendingLoads;
+		bool bSaving = false;
+		bool bSaveAgain = false;
+	};
+
+	static void StartSave(const FString& SlotName, const TSharedRef<FSlot>& Slot);
+
+	TMap<FString, TSharedRef<FSlot>> Slots;
+};
\ No newline at end of file
@@ -0,0 +1,326 @@
+// ==================================================================
+// FarmEventBusSubsystem.cpp
+// ==================================================================
+
+#include "FarmEventBusSubsystem.h"
+#include "MyProject/VR/Actors/Cultivo.h"
+#include "MyProject/VR/Actors/ParcelaFieldActor.h"
+#include "MyProject/VR/Actors/ParcelaTierra.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/GameModes/HarvestHavenGameManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Event Bus Flush"), STAT_FarmEventBusFlush, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Event Bus Posted"), STAT_FarmEventBusPosted, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Event Bus Delivered"), STAT_FarmEventBusDelivered, STATGROUP_HarvestHaven);
+
+UFarmEventBusSubsystem* UFarmEventBusSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmEventBusSubsystem>() : nullptr;
+}
+
+void UFarmEventBusSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Actors destroyed outside the pool get their queued events before they go
+	if (UWorld* World = GetWorld())
+	{
+		ActorDestroyedHandle = World->AddOnActorDestroyedHandler(
+			FOnActorDestroyed::FDelegate::CreateUObject(this, &UFarmEventBusSubsystem::HandleActorDestroyed));
+	}
+}
+
+void UFarmEventBusSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	ActorDestroyedHandle.Reset();
+
+	// Whatever is still queued belongs to actors that are going away
+	for (int32 TypeIndex = 0; TypeIndex < NumEventTypes; ++TypeIndex)
+	{
+		Pending[TypeIndex].Empty();
+		Delivering[TypeIndex].Empty();
+		Subscribers[TypeIndex].Clear();
+	}
+	PendingIndex.Empty();
+	PendingBySource.Empty();
+	NumFlushedEarly = 0;
+
+	Super::Deinitialize();
+}
+
+bool UFarmEventBusSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================================
+// POSTING
+// ============================================================
+
+void UFarmEventBusSubsystem::Post(const UObject* WorldContextObject, const FFarmBusEvent& Event)
+{
+	if (UFarmEventBusSubsystem* Bus = Get(WorldContextObject))
+	{
+		Bus->Enqueue(Event);
+		return;
+	}
+
+	BroadcastToBlueprint(Event);
+}
+
+void UFarmEventBusSubsystem::Enqueue(const FFarmBusEvent& Event)
+{
+	if (Event.Type >= EFarmBusEvent::Count)
+	{
+		return;
+	}
+
+	if (!bBatchEvents || IsTerminal(Event.Type))
+	{
+		Deliver(Event.Type, MakeArrayView(&Event, 1));
+		return;
+	}
+
+	++NumPosted;
+
+	FEventKey Key;
+	Key.Source = FObjectKey(Event.Source.Get());
+	Key.Item = Event.Item;
+	Key.Type = Event.Type;
+
+	TArray<FFarmBusEvent>& Queue = Pending[static_cast<int32>(Event.Type)];
+
+	// Same type, source and item already queued this frame: the newer event wins
+	if (const int32* Index = PendingIndex.Find(Key))
+	{
+		Queue[*Index] = Event;
+		return;
+	}
+
+	PendingIndex.Add(Key, Queue.Add(Event));
+	PendingBySource.FindOrAdd(Key.Source).Add(Key);
+}
+
+// ============================================================
+// SUBSCRIPTIONS
+// ============================================================
+
+FDelegateHandle UFarmEventBusSubsystem::Subscribe(EFarmBusEvent Type, FOnFarmBusEvents::FDelegate&& Delegate)
+{
+	if (Type >= EFarmBusEvent::Count)
+	{
+		return FDelegateHandle();
+	}
+
+	return Subscribers[static_cast<int32>(Type)].Add(MoveTemp(Delegate));
+}
+
+void UFarmEventBusSubsystem::Unsubscribe(EFarmBusEvent Type, FDelegateHandle Handle)
+{
+	if (Type < EFarmBusEvent::Count)
+	{
+		Subscribers[static_cast<int32>(Type)].Remove(Handle);
+	}
+}
+
+void UFarmEventBusSubsystem::UnsubscribeAll(const void* UserObject)
+{
+	for (FOnFarmBusEvents& TypeSubscribers : Subscribers)
+	{
+		TypeSubscribers.RemoveAll(UserObject);
+	}
+}
+
+// ============================================================
+// DELIVERY
+// ============================================================
+
+void UFarmEventBusSubsystem::Tick(float DeltaTime)
+{
+	Flush();
+}
+
+void UFarmEventBusSubsystem::Flush()
+{
+	if (bFlushing || (PendingIndex.Num() == 0 && NumFlushedEarly == 0))
+	{
+		return;
+	}
+
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmEventBusFlush);
+	FARM_TRACE_EVENT_SCOPE(Farm_EventBusFlush);
+
+	TGuardValue<bool> FlushGuard(bFlushing, true);
+
+	// Take the whole frame first: what subscribers post from here on waits for the next flush
+	for (int32 TypeIndex = 0; TypeIndex < NumEventTypes; ++TypeIndex)
+	{
+		Delivering[TypeIndex].Reset();
+		Swap(Delivering[TypeIndex], Pending[TypeIndex]);
+	}
+	PendingIndex.Reset();
+	PendingBySource.Reset();
+
+	// Drop what FlushSource already delivered
+	if (NumFlushedEarly > 0)
+	{
+		for (TArray<FFarmBusEvent>& Batch : Delivering)
+		{
+			Batch.RemoveAll([](const FFarmBusEvent& Event) { return Event.Type == EFarmBusEvent::Count; });
+		}
+		NumFlushedEarly = 0;
+	}
+
+	int32 NumDelivered = 0;
+	for (int32 TypeIndex = 0; TypeIndex < NumEventTypes; ++TypeIndex)
+	{
+		if (Delivering[TypeIndex].Num() > 0)
+		{
+			Deliver(static_cast<EFarmBusEvent>(TypeIndex), Delivering[TypeIndex]);
+			NumDelivered += Delivering[TypeIndex].Num();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_FarmEventBusPosted, NumPosted);
+	SET_DWORD_STAT(STAT_FarmEventBusDelivered, NumDelivered);
+	NumPosted = 0;
+}
+
+void UFarmEventBusSubsystem::FlushSource(const UObject* Source)
+{
+	TArray<FEventKey, TInlineAllocator<4>> Keys;
+	if (!Source || !PendingBySource.RemoveAndCopyValue(FObjectKey(Source), Keys))
+	{
+		return;
+	}
+
+	for (const FEventKey& Key : Keys)
+	{
+		int32 Index = INDEX_NONE;
+		if (!PendingIndex.RemoveAndCopyValue(Key, Index))
+		{
+			continue;
+		}
+
+		// Copied out: a subscriber may post and grow the queue while this is delivered
+		FFarmBusEvent& Queued = Pending[static_cast<int32>(Key.Type)][Index];
+		const FFarmBusEvent Event = Queued;
+		Queued.Type = EFarmBusEvent::Count;
+		++NumFlushedEarly;
+
+		Deliver(Event.Type, MakeArrayView(&Event, 1));
+	}
+}
+
+void UFarmEventBusSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	FlushSource(Actor);
+}
+
+void UFarmEventBusSubsystem::Deliver(EFarmBusEvent Type, TConstArrayView<FFarmBusEvent> Events)
+{
+	Subscribers[static_cast<int32>(Type)].Broadcast(Events);
+
+	if (bBlueprintAdapter)
+	{
+		for (const FFarmBusEvent& Event : Events)
+		{
+			BroadcastToBlueprint(Event);
+		}
+	}
+}
+
+TStatId UFarmEventBusSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmEventBusSubsystem, STATGROUP_Tickables);
+}
+
+// ============================================================
+// BLUEPRINT ADAPTER
+// ============================================================
+
+void UFarmEventBusSubsystem::BroadcastToBlueprint(const FFarmBusEvent& Event)
+{
+	UObject* Source = Event.Source.Get();
+	if (!Source)
+	{
+		return;
+	}
+
+	switch (Event.Type)
+	{
+	case EFarmBusEvent::CropStateChanged:
+		if (ACultivo* Cultivo = Cast<ACultivo>(Source))
+		{
+			Cultivo->OnStateChanged.Broadcast(static_cast<ECultivoState>(Event.Value), Event.FloatValue);
+		}
+		break;
+
+	case EFarmBusEvent::CropNeedsWater:
+		if (ACultivo* Cultivo = Cast<ACultivo>(Source))
+		{
+			Cultivo->OnNeedsWater.Broadcast();
+		}
+		break;
+
+	case EFarmBusEvent::CropHarvested:
+		if (ACultivo* Cultivo = Cast<ACultivo>(Source))
+		{
+			Cultivo->OnHarvested.Broadcast();
+		}
+		break;
+
+	case EFarmBusEvent::ParcelaStateChanged:
+		if (AParcelaTierra* Parcela = Cast<AParcelaTierra>(Source))
+		{
+			Parcela->OnStateChanged.Broadcast(static_cast<EParcelaState>(Event.Value));
+		}
+		else if (AParcelaFieldActor* Field = Cast<AParcelaFieldActor>(Source))
+		{
+			Field->OnCellStateChanged.Broadcast(Event.Item, static_cast<EParcelaState>(Event.Value));
+		}
+		break;
+
+	case EFarmBusEvent::CultivoPlanted:
+		if (AParcelaTierra* Parcela = Cast<AParcelaTierra>(Source))
+		{
+			Parcela->OnCultivoPlanted.Broadcast(Cast<ACultivo>(Event.Subject.Get()));
+		}
+		else if (AParcelaFieldActor* Field = Cast<AParcelaFieldActor>(Source))
+		{
+			Field->OnCellCultivoPlanted.Broadcast(Event.Item, Cast<ACultivo>(Event.Subject.Get()));
+		}
+		break;
+
+	case EFarmBusEvent::MoneyChanged:
+		if (AHarvestHavenGameManager* GameManager = Cast<AHarvestHavenGameManager>(Source))
+		{
+			GameManager->OnMoneyChanged.Broadcast(Event.Value);
+		}
+		break;
+
+	case EFarmBusEvent::LevelChanged:
+		if (AHarvestHavenGameManager* GameManager = Cast<AHarvestHavenGameManager>(Source))
+		{
+			GameManager->OnLevelChanged.Broadcast(Event.Value);
+		}
+		break;
+
+	case EFarmBusEvent::InventoryChanged:
+		if (AHarvestHavenGameManager* GameManager = Cast<AHarvestHavenGameManager>(Source))
+		{
+			GameManager->OnInventoryChanged.Broadcast(static_cast<ECultivoType>(Event.Item), Event.Value);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
\ No newline at end of file
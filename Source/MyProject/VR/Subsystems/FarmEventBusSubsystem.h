@@ -0,0 +1,163 @@
+// ==================================================================
+// FarmEventBusSubsystem.h
+// Typed farm events queued per frame, coalesced and delivered in batches
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FarmEventBusSubsystem.generated.h"
+
+UENUM()
+enum class EFarmBusEvent : uint8
+{
+	CropStateChanged,		// Source = ACultivo, Value = ECultivoState, FloatValue = growth %
+	CropNeedsWater,			// Source = ACultivo
+	CropHarvested,			// Source = ACultivo
+	ParcelaStateChanged,	// Source = AParcelaTierra / AParcelaFieldActor, Item = cell, Value = EParcelaState
+	CultivoPlanted,			// Source = AParcelaTierra / AParcelaFieldActor, Item = cell, Subject = ACultivo
+	MoneyChanged,			// Source = game manager, Value = money
+	LevelChanged,			// Source = game manager, Value = level
+	InventoryChanged,		// Source = game manager, Item = ECultivoType, Value = seeds left
+
+	Count UMETA(Hidden)
+};
+
+/** One farm event. Compact and copied by value; objects are weak because delivery is deferred. */
+struct FFarmBusEvent
+{
+	EFarmBusEvent Type = EFarmBusEvent::Count;
+
+	// Field cell or crop type; INDEX_NONE when the event is about the whole source
+	int32 Item = INDEX_NONE;
+
+	int32 Value = 0;
+	float FloatValue = 0.0f;
+
+	TWeakObjectPtr<UObject> Source;
+	TWeakObjectPtr<UObject> Subject;
+
+	FFarmBusEvent() = default;
+	FFarmBusEvent(EFarmBusEvent InType, UObject* InSource, int32 InItem = INDEX_NONE, int32 InValue = 0, float InFloatValue = 0.0f)
+		: Type(InType), Item(InItem), Value(InValue), FloatValue(InFloatValue), Source(InSource)
+	{}
+};
+
+// A frame's events of one type, at most one per source and item
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnFarmBusEvents, TConstArrayView<FFarmBusEvent>);
+
+/**
+ * Farm event bus.
+ *
+ * Producers (crops, parcels, the game manager) Post events instead of broadcasting at the point
+ * of change. Events wait in per-type queues; a later event with the same type, source and item
+ * replaces the queued one, so a bulk sale of 200 crops delivers a single MoneyChanged with the
+ * final amount. Once per frame, after the actors have ticked, every type with events is handed
+ * to its native subscribers as one batch.
+ *
+ * Blueprint bindings keep working: the adapter re-broadcasts each delivered event through the
+ * source's BlueprintAssignable delegate (OnStateChanged, OnMoneyChanged, ...). Those now
+ * fire at the end of the frame, once per coalesced event.
+ *
+ * Events posted while a batch is being delivered go out the next frame. Worlds without the bus
+ * (editor) and bBatchEvents off deliver at once, as before.
+ *
+ * Events that must reach a live source are not deferred past it: CropHarvested is delivered
+ * when posted, and a source's queued events are delivered early (FlushSource) when it is
+ * returned to the actor pool or destroyed.
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmEventBusSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Off: every Post is delivered immediately, one event at a time
+	UPROPERTY(Config, EditAnywhere, Category = "Event Bus")
+	bool bBatchEvents = true;
+
+	// Re-broadcast delivered events through the actors' Blueprint delegates
+	UPROPERTY(Config, EditAnywhere, Category = "Event Bus")
+	bool bBlueprintAdapter = true;
+
+	static UFarmEventBusSubsystem* Get(const UObject* WorldContextObject);
+
+	// Queues Event on the bus of WorldContextObject's world, or delivers it now when there is none
+	static void Post(const UObject* WorldContextObject, const FFarmBusEvent& Event);
+
+	void Enqueue(const FFarmBusEvent& Event);
+
+	// Native subscription; the delegate receives each frame's batch of Type
+	FDelegateHandle Subscribe(EFarmBusEvent Type, FOnFarmBusEvents::FDelegate&& Delegate);
+	void Unsubscribe(EFarmBusEvent Type, FDelegateHandle Handle);
+
+	// Removes every subscription bound to UserObject
+	void UnsubscribeAll(const void* UserObject);
+
+	// Delivers everything queued so far (Tick does this once per frame)
+	void Flush();
+
+	// Delivers Source's queued events now, ahead of the frame's batch
+	void FlushSource(const UObject* Source);
+
+	int32 GetPendingCount() const { return PendingIndex.Num(); }
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FEventKey
+	{
+		FObjectKey Source;
+		int32 Item = INDEX_NONE;
+		EFarmBusEvent Type = EFarmBusEvent::Count;
+
+		bool operator==(const FEventKey& Other) const
+		{
+			return Source == Other.Source && Item == Other.Item && Type == Other.Type;
+		}
+
+		friend uint32 GetTypeHash(const FEventKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Source), HashCombine(::GetTypeHash(Key.Item), ::GetTypeHash(static_cast<uint8>(Key.Type))));
+		}
+	};
+
+	void Deliver(EFarmBusEvent Type, TConstArrayView<FFarmBusEvent> Events);
+
+	// Events about the end of their source's life, never queued
+	static bool IsTerminal(EFarmBusEvent Type) { return Type == EFarmBusEvent::CropHarvested; }
+
+	void HandleActorDestroyed(AActor* Actor);
+
+	// Blueprint adapter: fires the source's dynamic delegate for Event
+	static void BroadcastToBlueprint(const FFarmBusEvent& Event);
+
+	static constexpr int32 NumEventTypes = static_cast<int32>(EFarmBusEvent::Count);
+
+	FOnFarmBusEvents Subscribers[NumEventTypes];
+
+	// This frame's events per type, and where each key sits in them
+	TArray<FFarmBusEvent> Pending[NumEventTypes];
+	TMap<FEventKey, int32> PendingIndex;
+
+	// Queued keys per source, for FlushSource; flushed entries stay in Pending as Type == Count
+	TMap<FObjectKey, TArray<FEventKey, TInlineAllocator<4>>> PendingBySource;
+	int32 NumFlushedEarly = 0;
+
+	// Batches being delivered; kept to reuse their memory
+	TArray<FFarmBusEvent> Delivering[NumEventTypes];
+
+	FDelegateHandle ActorDestroyedHandle;
+	int32 NumPosted = 0;
+	bool bFlushing = false;
+};
\ No newline at end of file
@@ -0,0 +1,594 @@
+// ==================================================================
+// FarmFXSubsystem.cpp
+// ==================================================================
+
+#include "FarmFXSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Sound/SoundBase.h"
+
+DECLARE_CYCLE_STAT(TEXT("FX Tick"), STAT_FarmFXTick, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FX Live Emitters"), STAT_FarmFXLiveEmitters, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FX Live Sounds"), STAT_FarmFXLiveSounds, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FX Virtual"), STAT_FarmFXVirtual, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FX Dropped (budget)"), STAT_FarmFXDroppedBudget, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FX Dropped (distance)"), STAT_FarmFXDroppedDistance, STATGROUP_HarvestHaven);
+
+UFarmFXSubsystem* UFarmFXSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmFXSubsystem>() : nullptr;
+}
+
+bool UFarmFXSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFarmFXSubsystem::Deinitialize()
+{
+	for (FFarmFXInstance& Instance : Instances)
+	{
+		if (IsValid(Instance.Component))
+		{
+			Instance.Component->DestroyComponent();
+		}
+	}
+	Instances.Reset();
+
+	for (UNiagaraComponent* Component : IdleNiagara)
+	{
+		if (IsValid(Component))
+		{
+			Component->DestroyComponent();
+		}
+	}
+	for (UParticleSystemComponent* Component : IdleCascade)
+	{
+		if (IsValid(Component))
+		{
+			Component->DestroyComponent();
+		}
+	}
+	for (UAudioComponent* Component : IdleAudio)
+	{
+		if (IsValid(Component))
+		{
+			Component->DestroyComponent();
+		}
+	}
+	IdleNiagara.Reset();
+	IdleCascade.Reset();
+	IdleAudio.Reset();
+
+	SET_DWORD_STAT(STAT_FarmFXLiveEmitters, 0);
+	SET_DWORD_STAT(STAT_FarmFXLiveSounds, 0);
+	SET_DWORD_STAT(STAT_FarmFXVirtual, 0);
+
+	Super::Deinitialize();
+}
+
+// ============================================================
+// PLAY / STOP
+// ============================================================
+
+FFarmFXHandle UFarmFXSubsystem::PlayFX(UFXSystemAsset* Asset, const FFarmFXParams& Params)
+{
+	return Play(Asset, false, Params);
+}
+
+FFarmFXHandle UFarmFXSubsystem::PlaySound(USoundBase* Sound, const FFarmFXParams& Params)
+{
+	return Play(Sound, true, Params);
+}
+
+FFarmFXHandle UFarmFXSubsystem::Play(UObject* Asset, bool bSound, const FFarmFXParams& Params)
+{
+	FFarmFXHandle Handle;
+	if (!Asset || !GetWorld())
+	{
+		return Handle;
+	}
+
+	const bool bKeyed = Params.Owner && !Params.Key.IsNone();
+
+	// Same owner and key: resume the instance already there instead of adding one
+	if (bKeyed)
+	{
+		if (FFarmFXInstance* Existing = FindKeyed(Params.Owner, Params.Key, bSound))
+		{
+			const bool bWasStopping = Existing->bStopping;
+			const bool bAssetChanged = Existing->Asset != Asset;
+
+			Existing->Asset = Asset;
+			Existing->bStopping = false;
+			Existing->Location = Params.Location;
+			Existing->Rotation = Params.Rotation;
+			Existing->VolumeMultiplier = Params.VolumeMultiplier;
+
+			if (Existing->Component && (bAssetChanged || !IsComponentPlaying(*Existing)))
+			{
+				Virtualize(*Existing);
+				Realize(*Existing);
+			}
+			else if (Existing->Component && bWasStopping)
+			{
+				// Resume without a reset, so particles still in the air are kept
+				if (UAudioComponent* Audio = Cast<UAudioComponent>(Existing->Component))
+				{
+					Audio->Play();
+				}
+				else
+				{
+					Existing->Component->Activate(false);
+				}
+			}
+
+			Handle.Id = Existing->Id;
+			return Handle;
+		}
+	}
+
+	FFarmFXInstance Instance;
+	Instance.Id = NextId++;
+	Instance.Asset = Asset;
+	Instance.Category = Params.Category;
+	Instance.bSound = bSound;
+	Instance.Owner = Params.Owner;
+	Instance.bHasOwner = Params.Owner != nullptr;
+	Instance.Key = Params.Key;
+	Instance.AttachTo = Params.AttachTo;
+	Instance.bAttached = Params.AttachTo != nullptr;
+	Instance.Socket = Params.Socket;
+	Instance.Location = Params.Location;
+	Instance.Rotation = Params.Rotation;
+	Instance.VolumeMultiplier = Params.VolumeMultiplier;
+
+	FVector ViewLocation;
+	const bool bHasView = GetViewLocation(ViewLocation);
+
+	// Keyed requests are kept as virtual instances; one-shots are dropped
+	if (IsCulled(Instance, bHasView, ViewLocation))
+	{
+		INC_DWORD_STAT(STAT_FarmFXDroppedDistance);
+		if (!bKeyed)
+		{
+			return Handle;
+		}
+	}
+	else if (HasBudget(Instance.Category, bSound) || StealSlot(Instance.Category, bSound))
+	{
+		Realize(Instance);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_FarmFXDroppedBudget);
+		if (!bKeyed)
+		{
+			return Handle;
+		}
+	}
+
+	Handle.Id = Instance.Id;
+	Instances.Add(MoveTemp(Instance));
+	return Handle;
+}
+
+void UFarmFXSubsystem::Stop(FFarmFXHandle& Handle, bool bImmediate)
+{
+	if (FFarmFXInstance* Instance = FindInstance(Handle.Id))
+	{
+		StopInstance(*Instance, bImmediate);
+	}
+
+	Handle.Id = INDEX_NONE;
+}
+
+void UFarmFXSubsystem::StopKeyed(const UObject* Owner, FName Key, bool bImmediate)
+{
+	for (FFarmFXInstance& Instance : Instances)
+	{
+		if (Instance.bHasOwner && Instance.Owner.Get() == Owner && Instance.Key == Key)
+		{
+			StopInstance(Instance, bImmediate);
+		}
+	}
+}
+
+void UFarmFXSubsystem::StopAll(const UObject* Owner, bool bImmediate)
+{
+	for (FFarmFXInstance& Instance : Instances)
+	{
+		if (Instance.bHasOwner && Instance.Owner.Get() == Owner)
+		{
+			StopInstance(Instance, bImmediate);
+		}
+	}
+}
+
+bool UFarmFXSubsystem::IsPlaying(const FFarmFXHandle& Handle) const
+{
+	const FFarmFXInstance* Instance = FindInstance(Handle.Id);
+	return Instance && !Instance->bStopping;
+}
+
+void UFarmFXSubsystem::StopInstance(FFarmFXInstance& Instance, bool bImmediate)
+{
+	if (Instance.bStopping && !bImmediate)
+	{
+		return;
+	}
+
+	Instance.bStopping = true;
+	Instance.StopTime = GetWorld()->GetTimeSeconds();
+
+	// Tick removes the instance once its component has finished
+	if (bImmediate || !Instance.Component)
+	{
+		Virtualize(Instance);
+		return;
+	}
+
+	if (UAudioComponent* Audio = Cast<UAudioComponent>(Instance.Component))
+	{
+		Audio->FadeOut(StopFadeOutTime, 0.0f);
+	}
+	else
+	{
+		Instance.Component->Deactivate();
+	}
+}
+
+// ============================================================
+// TICK
+// ============================================================
+
+void UFarmFXSubsystem::Tick(float DeltaTime)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmFXTick);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (int32 Index = Instances.Num() - 1; Index >= 0; --Index)
+	{
+		FFarmFXInstance& Instance = Instances[Index];
+
+		bool bDone;
+		if ((Instance.bHasOwner && !Instance.Owner.IsValid()) || (Instance.bAttached && !Instance.AttachTo.IsValid()))
+		{
+			// Owner or attach parent destroyed
+			bDone = true;
+		}
+		else if (Instance.Component)
+		{
+			bDone = !IsComponentPlaying(Instance) || (Instance.bStopping && Now - Instance.StopTime > StopTimeout);
+		}
+		else
+		{
+			bDone = Instance.bStopping;
+		}
+
+		if (bDone)
+		{
+			Virtualize(Instance);
+			Instances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	TimeSinceCullCheck += DeltaTime;
+	if (TimeSinceCullCheck >= CullCheckInterval)
+	{
+		TimeSinceCullCheck = 0.0f;
+		UpdateCulling();
+	}
+
+	const int32 NumLiveEmitters = GetLiveEmitterCount();
+	const int32 NumLiveSounds = GetLiveSoundCount();
+	SET_DWORD_STAT(STAT_FarmFXLiveEmitters, NumLiveEmitters);
+	SET_DWORD_STAT(STAT_FarmFXLiveSounds, NumLiveSounds);
+	SET_DWORD_STAT(STAT_FarmFXVirtual, Instances.Num() - NumLiveEmitters - NumLiveSounds);
+}
+
+TStatId UFarmFXSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmFXSubsystem, STATGROUP_Tickables);
+}
+
+// ============================================================
+// BUDGET
+// ============================================================
+
+FFarmFXInstance* UFarmFXSubsystem::FindInstance(int32 Id)
+{
+	return Id == INDEX_NONE ? nullptr : Instances.FindByPredicate([Id](const FFarmFXInstance& Instance) { return Instance.Id == Id; });
+}
+
+const FFarmFXInstance* UFarmFXSubsystem::FindInstance(int32 Id) const
+{
+	return Id == INDEX_NONE ? nullptr : Instances.FindByPredicate([Id](const FFarmFXInstance& Instance) { return Instance.Id == Id; });
+}
+
+FFarmFXInstance* UFarmFXSubsystem::FindKeyed(const UObject* Owner, FName Key, bool bSound)
+{
+	return Instances.FindByPredicate([Owner, Key, bSound](const FFarmFXInstance& Instance)
+	{
+		return Instance.bSound == bSound && Instance.Key == Key && Instance.bHasOwner && Instance.Owner.Get() == Owner;
+	});
+}
+
+const FFarmFXCategorySettings* UFarmFXSubsystem::FindCategorySettings(EFarmFXCategory Category) const
+{
+	return Categories.FindByPredicate([Category](const FFarmFXCategorySettings& Settings) { return Settings.Category == Category; });
+}
+
+int32 UFarmFXSubsystem::CountLive(bool bSound, const EFarmFXCategory* Category) const
+{
+	int32 NumLive = 0;
+	for (const FFarmFXInstance& Instance : Instances)
+	{
+		if (Instance.Component && Instance.bSound == bSound && (!Category || Instance.Category == *Category))
+		{
+			++NumLive;
+		}
+	}
+	return NumLive;
+}
+
+bool UFarmFXSubsystem::HasBudget(EFarmFXCategory Category, bool bSound) const
+{
+	const int32 GlobalLimit = bSound ? MaxLiveSounds : MaxLiveEmitters;
+	if (GlobalLimit > 0 && CountLive(bSound, nullptr) >= GlobalLimit)
+	{
+		return false;
+	}
+
+	const FFarmFXCategorySettings* Settings = FindCategorySettings(Category);
+	const int32 CategoryLimit = Settings ? (bSound ? Settings->MaxSounds : Settings->MaxEmitters) : 0;
+	return CategoryLimit <= 0 || CountLive(bSound, &Category) < CategoryLimit;
+}
+
+bool UFarmFXSubsystem::StealSlot(EFarmFXCategory Category, bool bSound)
+{
+	// Only one-shots of the same category give way; keyed instances are never cut
+	int32 OldestIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Instances.Num(); ++Index)
+	{
+		const FFarmFXInstance& Instance = Instances[Index];
+		if (Instance.Component && Instance.bSound == bSound && Instance.Category == Category && !Instance.IsKeyed()
+			&& (OldestIndex == INDEX_NONE || Instance.StartTime < Instances[OldestIndex].StartTime))
+		{
+			OldestIndex = Index;
+		}
+	}
+
+	if (OldestIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Virtualize(Instances[OldestIndex]);
+	Instances.RemoveAtSwap(OldestIndex, 1, EAllowShrinking::No);
+	return HasBudget(Category, bSound);
+}
+
+// ============================================================
+// DISTANCE CULLING
+// ============================================================
+
+bool UFarmFXSubsystem::IsCulled(const FFarmFXInstance& Instance, bool bHasView, const FVector& ViewLocation) const
+{
+	if (!bHasView)
+	{
+		return false;
+	}
+
+	const FFarmFXCategorySettings* Settings = FindCategorySettings(Instance.Category);
+	const float CullDistance = Settings && Settings->CullDistance > 0.0f ? Settings->CullDistance : DefaultCullDistance;
+	if (CullDistance <= 0.0f)
+	{
+		return false;
+	}
+
+	FVector Location = Instance.Location;
+	if (Instance.bAttached)
+	{
+		const USceneComponent* Parent = Instance.AttachTo.Get();
+		if (!Parent)
+		{
+			return true;
+		}
+		Location = Parent->GetSocketTransform(Instance.Socket).TransformPosition(Instance.Location);
+	}
+
+	return FVector::DistSquared(Location, ViewLocation) > FMath::Square(CullDistance);
+}
+
+void UFarmFXSubsystem::UpdateCulling()
+{
+	FVector ViewLocation;
+	const bool bHasView = GetViewLocation(ViewLocation);
+
+	// One-shots are short and left alone; keyed instances come and go with the player
+	for (FFarmFXInstance& Instance : Instances)
+	{
+		if (!Instance.IsKeyed() || Instance.bStopping)
+		{
+			continue;
+		}
+
+		const bool bCulled = IsCulled(Instance, bHasView, ViewLocation);
+		if (Instance.Component && bCulled)
+		{
+			Virtualize(Instance);
+		}
+		else if (!Instance.Component && !bCulled && HasBudget(Instance.Category, Instance.bSound))
+		{
+			Realize(Instance);
+		}
+	}
+}
+
+bool UFarmFXSubsystem::GetViewLocation(FVector& OutLocation) const
+{
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PlayerController)
+	{
+		return false;
+	}
+
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(OutLocation, ViewRotation);
+	return true;
+}
+
+// ============================================================
+// COMPONENTS
+// ============================================================
+
+void UFarmFXSubsystem::Realize(FFarmFXInstance& Instance)
+{
+	USceneComponent* Component = AcquireComponent(Instance.Asset);
+	if (!Component)
+	{
+		return;
+	}
+
+	if (USceneComponent* Parent = Instance.AttachTo.Get())
+	{
+		Component->AttachToComponent(Parent, FAttachmentTransformRules::KeepRelativeTransform, Instance.Socket);
+		Component->SetRelativeLocationAndRotation(Instance.Location, Instance.Rotation);
+	}
+	else
+	{
+		Component->SetWorldLocationAndRotation(Instance.Location, Instance.Rotation);
+	}
+
+	if (UAudioComponent* Audio = Cast<UAudioComponent>(Component))
+	{
+		Audio->SetVolumeMultiplier(Instance.VolumeMultiplier);
+		Audio->Play();
+	}
+	else
+	{
+		Component->Activate(true);
+	}
+
+	Instance.Component = Component;
+	Instance.StartTime = GetWorld()->GetTimeSeconds();
+}
+
+void UFarmFXSubsystem::Virtualize(FFarmFXInstance& Instance)
+{
+	ReleaseComponent(Instance.Component);
+	Instance.Component = nullptr;
+}
+
+bool UFarmFXSubsystem::IsComponentPlaying(const FFarmFXInstance& Instance) const
+{
+	if (const UAudioComponent* Audio = Cast<UAudioComponent>(Instance.Component))
+	{
+		return Audio->IsPlaying();
+	}
+
+	return Instance.Component && Instance.Component->IsActive();
+}
+
+USceneComponent* UFarmFXSubsystem::AcquireComponent(UObject* Asset)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (UNiagaraSystem* System = Cast<UNiagaraSystem>(Asset))
+	{
+		UNiagaraComponent* Component = IdleNiagara.Num() > 0 ? IdleNiagara.Pop(EAllowShrinking::No).Get() : nullptr;
+		if (!IsValid(Component))
+		{
+			Component = NewObject<UNiagaraComponent>(World);
+			Component->SetAutoDestroy(false);
+			Component->bAutoActivate = false;
+			Component->RegisterComponentWithWorld(World);
+		}
+		Component->SetAsset(System);
+		return Component;
+	}
+
+	if (UParticleSystem* Template = Cast<UParticleSystem>(Asset))
+	{
+		UParticleSystemComponent* Component = IdleCascade.Num() > 0 ? IdleCascade.Pop(EAllowShrinking::No).Get() : nullptr;
+		if (!IsValid(Component))
+		{
+			Component = NewObject<UParticleSystemComponent>(World);
+			Component->bAutoDestroy = false;
+			Component->bAutoActivate = false;
+			Component->RegisterComponentWithWorld(World);
+		}
+		Component->SetTemplate(Template);
+		return Component;
+	}
+
+	if (USoundBase* Sound = Cast<USoundBase>(Asset))
+	{
+		UAudioComponent* Component = IdleAudio.Num() > 0 ? IdleAudio.Pop(EAllowShrinking::No).Get() : nullptr;
+		if (!IsValid(Component))
+		{
+			Component = NewObject<UAudioComponent>(World);
+			Component->bAutoDestroy = false;
+			Component->bAutoActivate = false;
+			Component->RegisterComponentWithWorld(World);
+		}
+		Component->SetSound(Sound);
+		return Component;
+	}
+
+	return nullptr;
+}
+
+void UFarmFXSubsystem::ReleaseComponent(USceneComponent* Component)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+
+	if (UNiagaraComponent* Niagara = Cast<UNiagaraComponent>(Component))
+	{
+		Niagara->DeactivateImmediate();
+		if (IdleNiagara.Num() < MaxPooledPerType)
+		{
+			IdleNiagara.Add(Niagara);
+			return;
+		}
+	}
+	else if (UParticleSystemComponent* Cascade = Cast<UParticleSystemComponent>(Component))
+	{
+		Cascade->DeactivateImmediate();
+		if (IdleCascade.Num() < MaxPooledPerType)
+		{
+			IdleCascade.Add(Cascade);
+			return;
+		}
+	}
+	else if (UAudioComponent* Audio = Cast<UAudioComponent>(Component))
+	{
+		Audio->Stop();
+		if (IdleAudio.Num() < MaxPooledPerType)
+		{
+			IdleAudio.Add(Audio);
+			return;
+		}
+	}
+
+	Component->DestroyComponent();
+}
\ No newline at end of file
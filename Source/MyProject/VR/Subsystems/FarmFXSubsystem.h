@@ -0,0 +1,232 @@
+// ==================================================================
+// FarmFXSubsystem.h
+// Pooled particle and audio components with concurrency budgets and distance culling
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FarmFXSubsystem.generated.h"
+
+class UFXSystemAsset;
+class USoundBase;
+class UNiagaraComponent;
+class UParticleSystemComponent;
+class UAudioComponent;
+
+UENUM()
+enum class EFarmFXCategory : uint8
+{
+	Watering,
+	Refill,
+	Crops,
+	Digging,
+	Ambient,
+
+	Count UMETA(Hidden)
+};
+
+USTRUCT()
+struct FFarmFXCategorySettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	EFarmFXCategory Category = EFarmFXCategory::Watering;
+
+	// Live particle components in this category (0 = only the global limit)
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	int32 MaxEmitters = 0;
+
+	// Live audio components in this category (0 = only the global limit)
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	int32 MaxSounds = 0;
+
+	// Beyond this distance from the player nothing plays (0 = DefaultCullDistance)
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	float CullDistance = 0.0f;
+};
+
+/** Refers to one playing effect or sound; stays valid while it is virtual (culled or over budget). */
+USTRUCT(BlueprintType)
+struct FFarmFXHandle
+{
+	GENERATED_BODY()
+
+	int32 Id = INDEX_NONE;
+
+	bool IsValid() const { return Id != INDEX_NONE; }
+};
+
+/** How and where to play. Owner + Key make the request keyed: the same pair always maps to one instance. */
+struct FFarmFXParams
+{
+	EFarmFXCategory Category = EFarmFXCategory::Ambient;
+
+	// Attached: Location/Rotation are relative to AttachTo (and Socket). Otherwise world space
+	USceneComponent* AttachTo = nullptr;
+	FName Socket = NAME_None;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	// Stopped automatically when Owner goes away
+	const UObject* Owner = nullptr;
+	FName Key = NAME_None;
+
+	float VolumeMultiplier = 1.0f;
+};
+
+// One entry per effect or sound requested; Component is null while the entry is virtual
+USTRUCT()
+struct FFarmFXInstance
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<USceneComponent> Component = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UObject> Asset = nullptr;
+
+	int32 Id = INDEX_NONE;
+	EFarmFXCategory Category = EFarmFXCategory::Ambient;
+	bool bSound = false;
+	bool bStopping = false;
+
+	TWeakObjectPtr<const UObject> Owner;
+	bool bHasOwner = false;
+	FName Key = NAME_None;
+
+	TWeakObjectPtr<USceneComponent> AttachTo;
+	bool bAttached = false;
+	FName Socket = NAME_None;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float VolumeMultiplier = 1.0f;
+
+	double StartTime = 0.0;
+	double StopTime = 0.0;
+
+	bool IsKeyed() const { return bHasOwner && !Key.IsNone(); }
+};
+
+/**
+ * Farm service for particle effects (Niagara or Cascade) and sounds.
+ *
+ * Components come from per-type pools instead of being spawned per play. Keyed requests
+ * (Owner + Key, e.g. a watering can's pour) reuse their instance, so toggling an effect on and
+ * off never adds components. Global and per-category limits cap how many components are live;
+ * a request over budget steals the oldest one-shot of its category, or else a keyed request
+ * waits as a virtual instance and a one-shot is dropped. Instances farther than their category's
+ * cull distance from the player give their component back and resume when the player returns.
+ *
+ * Live, virtual and rejected counts show up under "stat HarvestHaven".
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmFXSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	int32 MaxLiveEmitters = 16;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	int32 MaxLiveSounds = 12;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	float DefaultCullDistance = 3000.0f;
+
+	// Seconds between distance checks of the keyed instances
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	float CullCheckInterval = 0.25f;
+
+	// Idle components kept per component type; the rest are destroyed
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	int32 MaxPooledPerType = 16;
+
+	// Sound fade-out on Stop
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	float StopFadeOutTime = 0.15f;
+
+	// A stopped effect still showing particles after this is cut off (seconds)
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	float StopTimeout = 3.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Farm FX")
+	TArray<FFarmFXCategorySettings> Categories;
+
+	static UFarmFXSubsystem* Get(const UObject* WorldContextObject);
+
+	// Asset is a UNiagaraSystem or a UParticleSystem. Returns an invalid handle when a one-shot is dropped
+	FFarmFXHandle PlayFX(UFXSystemAsset* Asset, const FFarmFXParams& Params);
+	FFarmFXHandle PlaySound(USoundBase* Sound, const FFarmFXParams& Params);
+
+	// Effects stop emitting and finish their particles; sounds fade out. bImmediate cuts both
+	void Stop(FFarmFXHandle& Handle, bool bImmediate = false);
+	void StopKeyed(const UObject* Owner, FName Key, bool bImmediate = false);
+
+	// Stops everything Owner started
+	void StopAll(const UObject* Owner, bool bImmediate = false);
+
+	bool IsPlaying(const FFarmFXHandle& Handle) const;
+
+	int32 GetLiveEmitterCount() const { return CountLive(false, nullptr); }
+	int32 GetLiveSoundCount() const { return CountLive(true, nullptr); }
+	int32 GetInstanceCount() const { return Instances.Num(); }
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FFarmFXHandle Play(UObject* Asset, bool bSound, const FFarmFXParams& Params);
+
+	FFarmFXInstance* FindInstance(int32 Id);
+	const FFarmFXInstance* FindInstance(int32 Id) const;
+	FFarmFXInstance* FindKeyed(const UObject* Owner, FName Key, bool bSound);
+
+	// Budget
+	int32 CountLive(bool bSound, const EFarmFXCategory* Category) const;
+	bool HasBudget(EFarmFXCategory Category, bool bSound) const;
+	bool StealSlot(EFarmFXCategory Category, bool bSound);
+	const FFarmFXCategorySettings* FindCategorySettings(EFarmFXCategory Category) const;
+
+	// Distance culling
+	bool IsCulled(const FFarmFXInstance& Instance, bool bHasView, const FVector& ViewLocation) const;
+	bool GetViewLocation(FVector& OutLocation) const;
+	void UpdateCulling();
+
+	// Gives the instance a pooled component and starts it
+	void Realize(FFarmFXInstance& Instance);
+
+	// Returns the component to its pool; the instance becomes virtual
+	void Virtualize(FFarmFXInstance& Instance);
+
+	void StopInstance(FFarmFXInstance& Instance, bool bImmediate);
+	bool IsComponentPlaying(const FFarmFXInstance& Instance) const;
+
+	USceneComponent* AcquireComponent(UObject* Asset);
+	void ReleaseComponent(USceneComponent* Component);
+
+	UPROPERTY(Transient)
+	TArray<FFarmFXInstance> Instances;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UNiagaraComponent>> IdleNiagara;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UParticleSystemComponent>> IdleCascade;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> IdleAudio;
+
+	int32 NextId = 0;
+	float TimeSinceCullCheck = 0.0f;
+};
\ No newline at end of file
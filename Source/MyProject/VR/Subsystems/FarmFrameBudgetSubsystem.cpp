@@ -0,0 +1,219 @@
+// ==================================================================
+// FarmFrameBudgetSubsystem.cpp
+// ==================================================================
+
+#include "FarmFrameBudgetSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("Frame Budget Scheduler"), STAT_FarmFrameBudget, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Work Run"), STAT_FarmBudgetWorkRun, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budget Work Deferred"), STAT_FarmBudgetWorkDeferred, STATGROUP_HarvestHaven);
+
+static TAutoConsoleVariable<float> CVarFarmBudgetMs(
+	TEXT("farm.Budget.Ms"),
+	0.0f,
+	TEXT("Overrides the farm frame budget in milliseconds (0 = use FrameBudgetMs from config)."));
+
+UFarmFrameBudgetSubsystem* UFarmFrameBudgetSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmFrameBudgetSubsystem>() : nullptr;
+}
+
+void UFarmFrameBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	for (const FFarmWorkSystemSettings& Settings : Systems)
+	{
+		if (Settings.System < EFarmWorkSystem::Count)
+		{
+			FWorkQueue& Queue = Queues[static_cast<int32>(Settings.System)];
+			Queue.Priority = Settings.Priority;
+			Queue.BudgetSeconds = FMath::Max(Settings.BudgetMs, 0.0f) / 1000.0;
+		}
+	}
+
+	QueueOrder.Reset();
+	for (int32 Index = 0; Index < static_cast<int32>(EFarmWorkSystem::Count); ++Index)
+	{
+		QueueOrder.Add(Index);
+	}
+	QueueOrder.StableSort([this](int32 A, int32 B) { return Queues[A].Priority < Queues[B].Priority; });
+}
+
+void UFarmFrameBudgetSubsystem::EnqueueWork(EFarmWorkSystem System, const UObject* Owner, TFunction<void()>&& Work)
+{
+	check(System < EFarmWorkSystem::Count);
+
+	FQueuedWork& Item = Queues[static_cast<int32>(System)].Queued.AddDefaulted_GetRef();
+	Item.Owner = Owner;
+	Item.Work = MoveTemp(Work);
+}
+
+void UFarmFrameBudgetSubsystem::RegisterRecurring(EFarmWorkSystem System, const UObject* Owner, float Interval, TFunction<void(float)>&& Work)
+{
+	check(System < EFarmWorkSystem::Count);
+
+	FWorkQueue& Queue = Queues[static_cast<int32>(System)];
+
+	// Never grow Recurring while one of its items is running
+	FRecurringWork& Item = (Queue.bRunning ? Queue.PendingRecurring : Queue.Recurring).AddDefaulted_GetRef();
+	Item.Owner = Owner;
+	Item.Work = MoveTemp(Work);
+	Item.Interval = FMath::Max(Interval, 0.0f);
+	Item.LastRunTime = GetWorld()->GetTimeSeconds();
+}
+
+void UFarmFrameBudgetSubsystem::UnregisterRecurring(EFarmWorkSystem System, const UObject* Owner)
+{
+	check(System < EFarmWorkSystem::Count);
+
+	FWorkQueue& Queue = Queues[static_cast<int32>(System)];
+	for (FRecurringWork& Item : Queue.Recurring)
+	{
+		if (Item.Owner.Get() == Owner)
+		{
+			Item.bRemoved = true;
+			Queue.bNeedsCompact = true;
+		}
+	}
+
+	Queue.PendingRecurring.RemoveAll([Owner](const FRecurringWork& Item) { return Item.Owner.Get() == Owner; });
+}
+
+int32 UFarmFrameBudgetSubsystem::GetDeferredCount(EFarmWorkSystem System) const
+{
+	return System < EFarmWorkSystem::Count ? Queues[static_cast<int32>(System)].NumDeferred : 0;
+}
+
+float UFarmFrameBudgetSubsystem::GetFrameBudgetMs() const
+{
+	const float OverrideMs = CVarFarmBudgetMs.GetValueOnGameThread();
+	return OverrideMs > 0.0f ? OverrideMs : FrameBudgetMs;
+}
+
+void UFarmFrameBudgetSubsystem::Tick(float DeltaTime)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmFrameBudget);
+
+	const double WorldTime = GetWorld()->GetTimeSeconds();
+	const double FrameDeadline = FPlatformTime::Seconds() + GetFrameBudgetMs() / 1000.0;
+
+	NumDeferred = 0;
+	for (const int32 QueueIndex : QueueOrder)
+	{
+		FWorkQueue& Queue = Queues[QueueIndex];
+
+		if (Queue.bNeedsCompact)
+		{
+			Queue.Recurring.RemoveAll([](const FRecurringWork& Item) { return Item.bRemoved; });
+			Queue.NextRecurring = Queue.Recurring.Num() > 0 ? Queue.NextRecurring % Queue.Recurring.Num() : 0;
+			Queue.bNeedsCompact = false;
+		}
+
+		if (Queue.PendingRecurring.Num() > 0)
+		{
+			Queue.Recurring.Append(MoveTemp(Queue.PendingRecurring));
+			Queue.PendingRecurring.Reset();
+		}
+
+		if (Queue.Queued.Num() > 0 || Queue.Recurring.Num() > 0)
+		{
+			RunQueue(Queue, WorldTime, FrameDeadline);
+		}
+
+		NumDeferred += Queue.NumDeferred;
+	}
+
+	NumOverrunFrames += NumDeferred > 0 ? 1 : 0;
+	SET_DWORD_STAT(STAT_FarmBudgetWorkDeferred, NumDeferred);
+}
+
+void UFarmFrameBudgetSubsystem::RunQueue(FWorkQueue& Queue, double WorldTime, double FrameDeadline)
+{
+	const double Deadline = Queue.BudgetSeconds > 0.0
+		? FMath::Min(FrameDeadline, FPlatformTime::Seconds() + Queue.BudgetSeconds)
+		: FrameDeadline;
+
+	// A starved system still gets one item so nothing waits forever
+	const bool bForceOne = Queue.FramesStarved >= MaxDeferFrames;
+
+	int32 NumRun = 0;
+	bool bOutOfTime = false;
+	auto HasTime = [&]()
+	{
+		bOutOfTime = bOutOfTime || (FPlatformTime::Seconds() >= Deadline && !(bForceOne && NumRun == 0));
+		return !bOutOfTime;
+	};
+
+	Queue.bRunning = true;
+
+	// One-shot work, oldest first. Items are moved out before running so new work can be queued
+	int32 NumConsumed = 0;
+	while (NumConsumed < Queue.Queued.Num() && HasTime())
+	{
+		FQueuedWork Item = MoveTemp(Queue.Queued[NumConsumed++]);
+		if (!Item.Owner.IsStale())
+		{
+			Item.Work();
+			++NumRun;
+		}
+	}
+	Queue.Queued.RemoveAt(0, NumConsumed, EAllowShrinking::No);
+
+	// Recurring work, round-robin from where the last frame ran out of time
+	int32 NumDueDeferred = 0;
+	int32 FirstDeferred = INDEX_NONE;
+	const int32 NumRecurring = Queue.Recurring.Num();
+
+	for (int32 Visited = 0; Visited < NumRecurring; ++Visited)
+	{
+		const int32 Index = (Queue.NextRecurring + Visited) % NumRecurring;
+		FRecurringWork& Item = Queue.Recurring[Index];
+
+		if (Item.bRemoved || WorldTime - Item.LastRunTime < Item.Interval)
+		{
+			continue;
+		}
+
+		if (Item.Owner.IsStale())
+		{
+			Item.bRemoved = true;
+			Queue.bNeedsCompact = true;
+			continue;
+		}
+
+		if (bOutOfTime || !HasTime())
+		{
+			FirstDeferred = FirstDeferred == INDEX_NONE ? Index : FirstDeferred;
+			++NumDueDeferred;
+			continue;
+		}
+
+		const float ElapsedTime = static_cast<float>(WorldTime - Item.LastRunTime);
+		Item.LastRunTime = WorldTime;
+		Item.Work(ElapsedTime);
+		++NumRun;
+	}
+
+	Queue.bRunning = false;
+
+	if (FirstDeferred != INDEX_NONE)
+	{
+		Queue.NextRecurring = FirstDeferred;
+	}
+
+	Queue.NumDeferred = Queue.Queued.Num() + NumDueDeferred;
+	Queue.FramesStarved = (NumRun == 0 && Queue.NumDeferred > 0) ? Queue.FramesStarved + 1 : 0;
+
+	INC_DWORD_STAT_BY(STAT_FarmBudgetWorkRun, NumRun);
+}
+
+TStatId UFarmFrameBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmFrameBudgetSubsystem, STATGROUP_Tickables);
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+// ==================================================================
+// FarmFrameBudgetSubsystem.h
+// Time-slices farm work so no single frame pays for every system at once
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FarmFrameBudgetSubsystem.generated.h"
+
+// Farm systems that hand work to the scheduler
+UENUM()
+enum class EFarmWorkSystem : uint8
+{
+	CropUpdate,
+	ProximityChecks,
+	DigStreaming,
+	Autosave,
+	SpawnQueue,
+	Count UMETA(Hidden)
+};
+
+// Higher priorities run first each frame and get the budget before lower ones
+UENUM()
+enum class EFarmWorkPriority : uint8
+{
+	Critical,
+	High,
+	Normal,
+	Low
+};
+
+USTRUCT()
+struct FFarmWorkSystemSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Config, EditAnywhere, Category = "Frame Budget")
+	EFarmWorkSystem System = EFarmWorkSystem::CropUpdate;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Frame Budget")
+	EFarmWorkPriority Priority = EFarmWorkPriority::Normal;
+
+	// Milliseconds this system may use per frame (0 = whatever the frame budget has left)
+	UPROPERTY(Config, EditAnywhere, Category = "Frame Budget")
+	float BudgetMs = 0.0f;
+};
+
+/**
+ * Frame-budget governor for farm systems.
+ *
+ * Systems either queue one-shot work (EnqueueWork) or register recurring work per object
+ * (RegisterRecurring), which runs once its interval has elapsed and receives the real time
+ * since its last run. Each frame the systems run in priority order until their own budget or
+ * the shared frame budget (FrameBudgetMs, or farm.Budget.Ms) is spent; what is left waits for
+ * later frames. A system starved for MaxDeferFrames still runs one item per frame.
+ *
+ * The deferred backlog shows up under "stat HarvestHaven".
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmFrameBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Total milliseconds per frame for all farm work (about 2 ms fits a 72/90 Hz headset)
+	UPROPERTY(Config, EditAnywhere, Category = "Frame Budget")
+	float FrameBudgetMs = 2.0f;
+
+	// Frames a system can go without running anything before it is forced to run one item
+	UPROPERTY(Config, EditAnywhere, Category = "Frame Budget")
+	int32 MaxDeferFrames = 30;
+
+	// Systems without an entry run at Normal priority with no budget of their own
+	UPROPERTY(Config, EditAnywhere, Category = "Frame Budget")
+	TArray<FFarmWorkSystemSettings> Systems;
+
+	static UFarmFrameBudgetSubsystem* Get(const UObject* WorldContextObject);
+
+	// One-shot work. Dropped without running if Owner is destroyed first
+	void EnqueueWork(EFarmWorkSystem System, const UObject* Owner, TFunction<void()>&& Work);
+
+	// Repeating work for Owner, at most once per Interval seconds (0 = every frame the budget allows)
+	void RegisterRecurring(EFarmWorkSystem System, const UObject* Owner, float Interval, TFunction<void(float ElapsedTime)>&& Work);
+	void UnregisterRecurring(EFarmWorkSystem System, const UObject* Owner);
+
+	// Items that were due but did not fit in the last frame
+	int32 GetDeferredCount() const { return NumDeferred; }
+	int32 GetDeferredCount(EFarmWorkSystem System) const;
+
+	// Frames that ended with deferred work, since the world started
+	int32 GetOverrunFrameCount() const { return NumOverrunFrames; }
+
+	float GetFrameBudgetMs() const;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FQueuedWork
+	{
+		TWeakObjectPtr<const UObject> Owner;
+		TFunction<void()> Work;
+	};
+
+	struct FRecurringWork
+	{
+		TWeakObjectPtr<const UObject> Owner;
+		TFunction<void(float)> Work;
+		float Interval = 0.0f;
+		double LastRunTime = 0.0;
+		bool bRemoved = false;
+	};
+
+	struct FWorkQueue
+	{
+		EFarmWorkPriority Priority = EFarmWorkPriority::Normal;
+		double BudgetSeconds = 0.0;
+
+		TArray<FQueuedWork> Queued;
+		TArray<FRecurringWork> Recurring;
+
+		// Registered while the queue was running; merged at the start of the next frame
+		TArray<FRecurringWork> PendingRecurring;
+
+		int32 NextRecurring = 0;
+		int32 FramesStarved = 0;
+		int32 NumDeferred = 0;
+		bool bRunning = false;
+		bool bNeedsCompact = false;
+	};
+
+	void RunQueue(FWorkQueue& Queue, double WorldTime, double FrameDeadline);
+
+	FWorkQueue Queues[static_cast<int32>(EFarmWorkSystem::Count)];
+
+	// Queue indices sorted by priority
+	TArray<int32, TInlineAllocator<static_cast<int32>(EFarmWorkSystem::Count)>> QueueOrder;
+
+	int32 NumDeferred = 0;
+	int32 NumOverrunFrames = 0;
+};
\ No newline at end of file
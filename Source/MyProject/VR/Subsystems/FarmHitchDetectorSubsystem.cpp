@@ -0,0 +1,215 @@
+// ==================================================================
+// FarmHitchDetectorSubsystem.cpp
+// ==================================================================
+
+#include "FarmHitchDetectorSubsystem.h"
+#include "FarmFrameBudgetSubsystem.h"
+#include "FarmSpawnQueueSubsystem.h"
+#include "MyProject/VR/Components/VRGrabComponent.h"
+#include "MyProject/VR/Diagnostics/FarmEventLog.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+#include "RenderCore.h"
+#include "RHI.h"
+#include "UObject/UObjectIterator.h"
+
+static FAutoConsoleCommandWithWorldAndArgs FarmHitchCaptureCommand(
+	TEXT("farm.Hitch.Capture"),
+	TEXT("Writes the hitch detector's current window to Saved/FarmHitches."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UFarmHitchDetectorSubsystem* HitchDetector = UFarmHitchDetectorSubsystem::Get(World))
+		{
+			HitchDetector->CaptureNow(TEXT("Manual"));
+		}
+	}));
+
+UFarmHitchDetectorSubsystem* UFarmHitchDetectorSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmHitchDetectorSubsystem>() : nullptr;
+}
+
+bool UFarmHitchDetectorSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !UE_BUILD_SHIPPING && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UFarmHitchDetectorSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFarmHitchDetectorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Sized for the fastest refresh rate we ship on
+	Samples.SetNum(FMath::Max(1, FMath::CeilToInt(WindowSeconds * 120.0f)));
+	StartTime = FPlatformTime::Seconds();
+
+	LastSceneQueries = FFarmCounters::Get(EFarmCounter::SceneQueries);
+	LastActorScans = FFarmCounters::Get(EFarmCounter::ActorScans);
+	LastDigStamps = FFarmCounters::Get(EFarmCounter::DigStamps);
+	LastCropStateChanges = FFarmCounters::Get(EFarmCounter::CropStateChanges);
+}
+
+void UFarmHitchDetectorSubsystem::Tick(float DeltaTime)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FFrameSample& Sample = Samples[NextSample];
+	RecordSample(Sample);
+	NextSample = (NextSample + 1) % Samples.Num();
+	NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+
+	const bool bHitch = Sample.FrameMs > TargetFrameMs * HitchMultiplier;
+	if (!bHitch || Sample.Time - StartTime < IgnoreFirstSeconds || NumCaptures >= MaxCapturesPerSession)
+	{
+		return;
+	}
+
+	FARM_EVENT(Hitch, nullptr, Sample.FrameMs);
+
+	if (LastCaptureTime < 0.0 || Sample.Time - LastCaptureTime >= MinSecondsBetweenCaptures)
+	{
+		CaptureNow(FString::Printf(TEXT("Frame %.1f ms"), Sample.FrameMs));
+	}
+}
+
+TStatId UFarmHitchDetectorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmHitchDetectorSubsystem, STATGROUP_Tickables);
+}
+
+void UFarmHitchDetectorSubsystem::RecordSample(FFrameSample& Sample)
+{
+	auto TakeDelta = [](EFarmCounter Counter, int64& Last)
+	{
+		const int64 Total = FFarmCounters::Get(Counter);
+		const int64 Delta = Total - Last;
+		Last = Total;
+		return static_cast<uint16>(FMath::Clamp<int64>(Delta, 0, MAX_uint16));
+	};
+
+	Sample.Time = FPlatformTime::Seconds();
+	Sample.Frame = static_cast<uint32>(GFrameCounter);
+	Sample.FrameMs = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+	Sample.GameMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	Sample.RenderMs = static_cast<float>(FPlatformTime::ToMilliseconds(GRenderThreadTime));
+	Sample.GpuMs = static_cast<float>(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles()));
+	Sample.SceneQueries = TakeDelta(EFarmCounter::SceneQueries, LastSceneQueries);
+	Sample.ActorScans = TakeDelta(EFarmCounter::ActorScans, LastActorScans);
+	Sample.DigStamps = TakeDelta(EFarmCounter::DigStamps, LastDigStamps);
+	Sample.CropStateChanges = TakeDelta(EFarmCounter::CropStateChanges, LastCropStateChanges);
+	Sample.GrabbablesHeld = static_cast<uint16>(FMath::Clamp<int64>(FFarmCounters::Get(EFarmCounter::GrabbablesHeld), 0, MAX_uint16));
+
+	const UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this);
+	Sample.DeferredWork = static_cast<uint16>(FMath::Min(FrameBudget ? FrameBudget->GetDeferredCount() : 0, static_cast<int32>(MAX_uint16)));
+}
+
+FString UFarmHitchDetectorSubsystem::CaptureNow(const FString& Reason)
+{
+	LastCaptureTime = FPlatformTime::Seconds();
+	++NumCaptures;
+
+	// Oldest first, only what falls inside the window
+	TArray<FFrameSample> Window;
+	Window.Reserve(NumSamples);
+	for (int32 Offset = NumSamples; Offset > 0; --Offset)
+	{
+		const FFrameSample& Sample = Samples[(NextSample - Offset + Samples.Num()) % Samples.Num()];
+		if (LastCaptureTime - Sample.Time <= WindowSeconds)
+		{
+			Window.Add(Sample);
+		}
+	}
+
+	const uint32 Frame = Window.Num() > 0 ? Window.Last().Frame : static_cast<uint32>(GFrameCounter);
+	const FString BasePath = FPaths::ProjectSavedDir() / TEXT("FarmHitches")
+		/ FString::Printf(TEXT("Hitch_%s_%u"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")), Frame);
+
+#if UE_TRACE_ENABLED
+	if (bWriteTraceSnapshot)
+	{
+		FTraceAuxiliary::WriteSnapshot(*(BasePath + TEXT(".utrace")));
+	}
+#endif
+
+	// Context needs the game thread; formatting and disk writes do not
+	FString Context = BuildContext(Reason, Window);
+
+	Async(EAsyncExecution::ThreadPool, [BasePath, Context = MoveTemp(Context), Window = MoveTemp(Window)]()
+	{
+		const double HitchTime = Window.Num() > 0 ? Window.Last().Time : 0.0;
+
+		FString Csv = Context;
+		Csv += TEXT("Time,Frame,FrameMs,GameMs,RenderMs,GpuMs,SceneQueries,ActorScans,DigStamps,CropStateChanges,DeferredWork,GrabbablesHeld\n");
+		for (const FFrameSample& Sample : Window)
+		{
+			Csv += FString::Printf(TEXT("%.4f,%u,%.2f,%.2f,%.2f,%.2f,%u,%u,%u,%u,%u,%u\n"),
+				Sample.Time - HitchTime, Sample.Frame, Sample.FrameMs, Sample.GameMs, Sample.RenderMs, Sample.GpuMs,
+				Sample.SceneQueries, Sample.ActorScans, Sample.DigStamps, Sample.CropStateChanges,
+				Sample.DeferredWork, Sample.GrabbablesHeld);
+		}
+
+		FFileHelper::SaveStringToFile(Csv, *(BasePath + TEXT(".csv")));
+		FFarmEventLog::DumpToFile(BasePath + TEXT("_events.bin"));
+	});
+
+	UE_LOG(LogHarvestHaven, Warning, TEXT("Hitch captured (%s): %s.csv"), *Reason, *BasePath);
+	return BasePath;
+}
+
+FString UFarmHitchDetectorSubsystem::BuildContext(const FString& Reason, const TArray<FFrameSample>& Window) const
+{
+	const UWorld* World = GetWorld();
+	const FFrameSample LastSample = Window.Num() > 0 ? Window.Last() : FFrameSample();
+
+	int32 WindowCropStateChanges = 0;
+	for (const FFrameSample& Sample : Window)
+	{
+		WindowCropStateChanges += Sample.CropStateChanges;
+	}
+
+	// What the hands were holding: a handful of components, only walked on a capture
+	TArray<FString> HeldTools;
+	for (TObjectIterator<UVRGrabComponent> It; It; ++It)
+	{
+		if (It->GetWorld() == World && It->IsGrabbed() && It->GetOwner())
+		{
+			const UMotionControllerComponent* Controller = It->GetGrabbingController();
+			HeldTools.Add(FString::Printf(TEXT("%s (%s)"), *It->GetOwner()->GetName(),
+				Controller ? *Controller->GetTrackingMotionSource().ToString() : TEXT("?")));
+		}
+	}
+
+	const UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this);
+
+	FString Context;
+	Context += FString::Printf(TEXT("# Reason,%s\n"), *Reason);
+	Context += FString::Printf(TEXT("# Map,%s\n"), World ? *World->GetMapName() : TEXT("-"));
+	Context += FString::Printf(TEXT("# Frame,%u\n"), LastSample.Frame);
+	Context += FString::Printf(TEXT("# FrameMs,%.2f\n"), LastSample.FrameMs);
+	Context += FString::Printf(TEXT("# TargetFrameMs,%.2f\n"), TargetFrameMs);
+	Context += FString::Printf(TEXT("# HeldTools,%s\n"), HeldTools.Num() > 0 ? *FString::Join(HeldTools, TEXT(";")) : TEXT("none"));
+	Context += FString::Printf(TEXT("# CropStateChanges,%u this frame,%d in window\n"), LastSample.CropStateChanges, WindowCropStateChanges);
+	Context += FString::Printf(TEXT("# Crops,%lld seed,%lld growing,%lld mature,%lld dry\n"),
+		FFarmCounters::Get(EFarmCounter::CropsSeed), FFarmCounters::Get(EFarmCounter::CropsGrowing),
+		FFarmCounters::Get(EFarmCounter::CropsMature), FFarmCounters::Get(EFarmCounter::CropsDry));
+	const UFarmSpawnQueueSubsystem* SpawnQueue = UFarmSpawnQueueSubsystem::Get(this);
+	Context += FString::Printf(TEXT("# PendingSpawns,%d\n"), SpawnQueue ? SpawnQueue->GetPendingCount() : 0);
+	Context += FString::Printf(TEXT("# DeferredWork,%d\n"), FrameBudget ? FrameBudget->GetDeferredCount() : 0);
+	return Context;
+}
\ No newline at end of file
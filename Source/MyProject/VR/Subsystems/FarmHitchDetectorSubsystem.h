@@ -0,0 +1,108 @@
+// ==================================================================
+// FarmHitchDetectorSubsystem.h
+// Keeps the last few seconds of frame data and writes them out on a hitch
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FarmHitchDetectorSubsystem.generated.h"
+
+/**
+ * Automatic hitch capture for play sessions on device.
+ *
+ * Every frame a small sample (frame/game/render/GPU times and the farm counters for that frame)
+ * goes into a ring covering WindowSeconds. When a frame takes longer than HitchMultiplier x
+ * TargetFrameMs, the window is written to Saved/FarmHitches/Hitch_<time>.csv together with the
+ * frame's context (held tools, crop state changes, pending spawns, deferred work) and a dump of
+ * the farm event log (_events.bin). The files are written off the game thread.
+ *
+ * "farm.Hitch.Capture" writes a capture on demand. Not created in Shipping.
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmHitchDetectorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	bool bEnabled = true;
+
+	// 13.9 ms = 72 Hz, 11.1 ms = 90 Hz
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	float TargetFrameMs = 13.9f;
+
+	// A frame longer than TargetFrameMs times this is a hitch
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	float HitchMultiplier = 1.5f;
+
+	// Seconds of history written with each capture
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	float WindowSeconds = 5.0f;
+
+	// Loading and warm-up frames are not hitches worth reporting
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	float IgnoreFirstSeconds = 5.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	float MinSecondsBetweenCaptures = 10.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	int32 MaxCapturesPerSession = 20;
+
+	// Also write an Insights snapshot (.utrace) when a trace is running
+	UPROPERTY(Config, EditAnywhere, Category = "Hitch Detector")
+	bool bWriteTraceSnapshot = false;
+
+	static UFarmHitchDetectorSubsystem* Get(const UObject* WorldContextObject);
+
+	// Writes the current window now. Returns the base path of the files (without extension)
+	FString CaptureNow(const FString& Reason);
+
+	int32 GetCaptureCount() const { return NumCaptures; }
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FFrameSample
+	{
+		double Time = 0.0;
+		uint32 Frame = 0;
+		float FrameMs = 0.0f;
+		float GameMs = 0.0f;
+		float RenderMs = 0.0f;
+		float GpuMs = 0.0f;
+		uint16 SceneQueries = 0;
+		uint16 ActorScans = 0;
+		uint16 DigStamps = 0;
+		uint16 CropStateChanges = 0;
+		uint16 DeferredWork = 0;
+		uint16 GrabbablesHeld = 0;
+	};
+
+	void RecordSample(FFrameSample& Sample);
+	FString BuildContext(const FString& Reason, const TArray<FFrameSample>& Window) const;
+
+	TArray<FFrameSample> Samples;
+	int32 NextSample = 0;
+	int32 NumSamples = 0;
+
+	// Running counter totals at the end of the last frame
+	int64 LastSceneQueries = 0;
+	int64 LastActorScans = 0;
+	int64 LastDigStamps = 0;
+	int64 LastCropStateChanges = 0;
+
+	double StartTime = 0.0;
+	double LastCaptureTime = -1.0;
+	int32 NumCaptures = 0;
+};
\ No newline at end of file
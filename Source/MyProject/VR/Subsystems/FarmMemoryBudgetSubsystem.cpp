@@ -0,0 +1,107 @@
+// ==================================================================
+// FarmMemoryBudgetSubsystem.cpp
+// ==================================================================
+
+#include "FarmMemoryBudgetSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice FarmMemoryReportCommand(
+	TEXT("farm.Memory.Report"),
+	TEXT("Prints LLM memory per farm system against its budget (run with -llm)."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (const UFarmMemoryBudgetSubsystem* MemoryBudget = UFarmMemoryBudgetSubsystem::Get(World))
+		{
+			MemoryBudget->PrintReport(Ar);
+		}
+	}));
+
+UFarmMemoryBudgetSubsystem* UFarmMemoryBudgetSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmMemoryBudgetSubsystem>() : nullptr;
+}
+
+int32 UFarmMemoryBudgetSubsystem::GetBudgetStatus(TArray<FFarmMemoryBudgetStatus>& OutStatus) const
+{
+	OutStatus.Reset();
+
+	int32 NumOverBudget = 0;
+	for (int32 Index = 0; Index < static_cast<int32>(EFarmMemorySystem::Count); ++Index)
+	{
+		const EFarmMemorySystem System = static_cast<EFarmMemorySystem>(Index);
+		const FFarmMemoryBudget* Budget = Budgets.FindByPredicate([System](const FFarmMemoryBudget& Entry)
+		{
+			return Entry.System == System;
+		});
+
+		const int64 UsedBytes = FFarmMemory::GetTrackedBytes(System);
+
+		FFarmMemoryBudgetStatus& Status = OutStatus.AddDefaulted_GetRef();
+		Status.SystemName = FFarmMemory::GetSystemName(System);
+		Status.UsedMB = UsedBytes >= 0 ? static_cast<double>(UsedBytes) / (1024.0 * 1024.0) : 0.0;
+		Status.BudgetMB = Budget ? Budget->BudgetMB : 0.0;
+		Status.bOverBudget = UsedBytes >= 0 && Status.BudgetMB > 0.0 && Status.UsedMB > Status.BudgetMB;
+
+		NumOverBudget += Status.bOverBudget ? 1 : 0;
+	}
+
+	return NumOverBudget;
+}
+
+void UFarmMemoryBudgetSubsystem::PrintReport(FOutputDevice& Ar) const
+{
+	if (!FFarmMemory::IsTrackingEnabled())
+	{
+		Ar.Logf(TEXT("FarmMemory: LLM is not running, start with -llm to measure the farm systems"));
+		return;
+	}
+
+	TArray<FFarmMemoryBudgetStatus> Table;
+	const int32 NumOverBudget = GetBudgetStatus(Table);
+
+	Ar.Logf(TEXT("FarmMemory: %d system(s) over budget"), NumOverBudget);
+	for (const FFarmMemoryBudgetStatus& Status : Table)
+	{
+		Ar.Logf(TEXT("  %-12s %8.2f MB / %8.2f MB%s"), Status.SystemName, Status.UsedMB, Status.BudgetMB,
+			Status.bOverBudget ? TEXT("  OVER") : TEXT(""));
+	}
+}
+
+void UFarmMemoryBudgetSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceLastCheck += DeltaTime;
+	if (TimeSinceLastCheck < CheckInterval || !FFarmMemory::IsTrackingEnabled())
+	{
+		return;
+	}
+
+	TimeSinceLastCheck = 0.0f;
+
+	TArray<FFarmMemoryBudgetStatus> Table;
+	GetBudgetStatus(Table);
+
+	for (int32 Index = 0; Index < Table.Num(); ++Index)
+	{
+		const FFarmMemoryBudgetStatus& Status = Table[Index];
+		const uint32 Bit = 1u << Index;
+
+		if (Status.bOverBudget && !(WarnedMask & Bit))
+		{
+			UE_LOG(LogHarvestHaven, Warning, TEXT("FarmMemory: %s over budget, %.2f MB of %.2f MB"),
+				Status.SystemName, Status.UsedMB, Status.BudgetMB);
+			WarnedMask |= Bit;
+		}
+		else if (!Status.bOverBudget)
+		{
+			WarnedMask &= ~Bit;
+		}
+	}
+}
+
+TStatId UFarmMemoryBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmMemoryBudgetSubsystem, STATGROUP_Tickables);
+}
\ No newline at end of file
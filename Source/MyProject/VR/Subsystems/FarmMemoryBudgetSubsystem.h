@@ -0,0 +1,70 @@
+// ==================================================================
+// FarmMemoryBudgetSubsystem.h
+// Per-system memory budgets checked against the farm LLM tags
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "FarmMemoryBudgetSubsystem.generated.h"
+
+USTRUCT()
+struct FFarmMemoryBudget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Config, EditAnywhere, Category = "Memory Budget")
+	EFarmMemorySystem System = EFarmMemorySystem::Crops;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Memory Budget")
+	float BudgetMB = 0.0f;
+};
+
+/** One row of the budget table. */
+struct FFarmMemoryBudgetStatus
+{
+	const TCHAR* SystemName = nullptr;
+	double UsedMB = 0.0;
+	double BudgetMB = 0.0;
+	bool bOverBudget = false;
+};
+
+/**
+ * Compares what LLM tracks for each farm system with its budget (DefaultGame.ini) and warns
+ * once when a system goes over. Needs -llm; without it nothing is measured and nothing fails.
+ *
+ * "farm.Memory.Report" prints the table; the stress commandlet fails when a run ends over budget.
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmMemoryBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Seconds between budget checks
+	UPROPERTY(Config, EditAnywhere, Category = "Memory Budget")
+	float CheckInterval = 5.0f;
+
+	// Systems without an entry have no budget
+	UPROPERTY(Config, EditAnywhere, Category = "Memory Budget")
+	TArray<FFarmMemoryBudget> Budgets;
+
+	static UFarmMemoryBudgetSubsystem* Get(const UObject* WorldContextObject);
+
+	// Fills the table and returns how many systems are over budget
+	int32 GetBudgetStatus(TArray<FFarmMemoryBudgetStatus>& OutStatus) const;
+
+	void PrintReport(FOutputDevice& Ar) const;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	float TimeSinceLastCheck = 0.0f;
+
+	// Systems already reported, so each overrun warns once
+	uint32 WarnedMask = 0;
+};
\ No newline at end of file
@@ -0,0 +1,332 @@
+// ==================================================================
+// FarmPhysicsSleepSubsystem.cpp
+// ==================================================================
+
+#include "FarmPhysicsSleepSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Physics Sleep Update"), STAT_FarmPhysicsSleepUpdate, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grabbables Simulated"), STAT_FarmGrabbablesSimulated, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grabbables Awake (active rigid bodies)"), STAT_FarmGrabbablesAwake, STATGROUP_HarvestHaven);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grabbables Demoted"), STAT_FarmGrabbablesDemoted, STATGROUP_HarvestHaven);
+
+UFarmPhysicsSleepSubsystem* UFarmPhysicsSleepSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmPhysicsSleepSubsystem>() : nullptr;
+}
+
+void UFarmPhysicsSleepSubsystem::RegisterBody(UPrimitiveComponent* Component)
+{
+	if (!Component || FindBody(Component))
+	{
+		return;
+	}
+
+	FSleepBody& Body = Bodies.AddDefaulted_GetRef();
+	Body.Component = Component;
+	Body.OriginalCollision = Component->GetCollisionEnabled();
+	Body.bOriginalNotifyHit = Component->BodyInstance.bNotifyRigidBodyCollision;
+}
+
+void UFarmPhysicsSleepSubsystem::UnregisterBody(UPrimitiveComponent* Component)
+{
+	const int32 Index = Bodies.IndexOfByPredicate([Component](const FSleepBody& Body) { return Body.Component.Get() == Component; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (Bodies[Index].State == EBodyState::Demoted && Component)
+	{
+		Component->OnComponentHit.RemoveDynamic(this, &UFarmPhysicsSleepSubsystem::OnDemotedBodyHit);
+	}
+
+	Bodies.RemoveAtSwap(Index);
+}
+
+void UFarmPhysicsSleepSubsystem::SetBodyHeld(UPrimitiveComponent* Component, bool bHeld)
+{
+	FSleepBody* Body = FindBody(Component);
+	if (!Body)
+	{
+		return;
+	}
+
+	if (bHeld)
+	{
+		// Restore the simulated state first so the grab sees the original physics setup
+		if (Body->State == EBodyState::Demoted)
+		{
+			PromoteBody(*Body);
+		}
+		Body->State = EBodyState::Held;
+	}
+	else if (Body->State == EBodyState::Held)
+	{
+		Body->State = EBodyState::Simulating;
+		Body->RestTime = 0.0f;
+	}
+}
+
+void UFarmPhysicsSleepSubsystem::RegisterWakeSource(USceneComponent* Source)
+{
+	if (Source)
+	{
+		WakeSources.AddUnique(Source);
+	}
+}
+
+void UFarmPhysicsSleepSubsystem::UnregisterWakeSource(USceneComponent* Source)
+{
+	WakeSources.Remove(Source);
+}
+
+void UFarmPhysicsSleepSubsystem::WakeBody(UPrimitiveComponent* Component)
+{
+	if (FSleepBody* Body = FindBody(Component))
+	{
+		if (Body->State == EBodyState::Demoted)
+		{
+			PromoteBody(*Body);
+		}
+		Body->RestTime = 0.0f;
+	}
+}
+
+void UFarmPhysicsSleepSubsystem::WakeBodiesInRadius(const FVector& Location, float Radius)
+{
+	for (FSleepBody& Body : Bodies)
+	{
+		UPrimitiveComponent* Component = Body.Component.Get();
+		if (!Component || Body.State != EBodyState::Demoted)
+		{
+			continue;
+		}
+
+		const FBoxSphereBounds& Bounds = Component->Bounds;
+		if (FVector::DistSquared(Location, Bounds.Origin) <= FMath::Square(Radius + Bounds.SphereRadius))
+		{
+			PromoteBody(Body);
+		}
+	}
+}
+
+void UFarmPhysicsSleepSubsystem::Tick(float DeltaTime)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmPhysicsSleepUpdate);
+
+	TimeSinceLastCheck += DeltaTime;
+	if (TimeSinceLastCheck >= CheckInterval)
+	{
+		UpdateBodies(TimeSinceLastCheck);
+		EnforceSimulatedCap();
+		TimeSinceLastCheck = 0.0f;
+	}
+
+	SET_DWORD_STAT(STAT_FarmGrabbablesSimulated, NumSimulated);
+	SET_DWORD_STAT(STAT_FarmGrabbablesAwake, NumAwake);
+	SET_DWORD_STAT(STAT_FarmGrabbablesDemoted, NumDemoted);
+}
+
+TStatId UFarmPhysicsSleepSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmPhysicsSleepSubsystem, STATGROUP_Tickables);
+}
+
+UFarmPhysicsSleepSubsystem::FSleepBody* UFarmPhysicsSleepSubsystem::FindBody(const UPrimitiveComponent* Component)
+{
+	return Bodies.FindByPredicate([Component](const FSleepBody& Body) { return Body.Component.Get() == Component; });
+}
+
+void UFarmPhysicsSleepSubsystem::DemoteBody(FSleepBody& Body)
+{
+	UPrimitiveComponent* Component = Body.Component.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	Body.OriginalCollision = Component->GetCollisionEnabled();
+	Body.bOriginalNotifyHit = Component->BodyInstance.bNotifyRigidBodyCollision;
+
+	Component->SetSimulatePhysics(false);
+
+	if (bDemoteToQueryOnly)
+	{
+		Component->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
+	else
+	{
+		// Still solid: a simulated body bumping into it wakes it up
+		Component->SetNotifyRigidBodyCollision(true);
+		Component->OnComponentHit.AddUniqueDynamic(this, &UFarmPhysicsSleepSubsystem::OnDemotedBodyHit);
+	}
+
+	Body.State = EBodyState::Demoted;
+	Body.RestTime = 0.0f;
+}
+
+void UFarmPhysicsSleepSubsystem::PromoteBody(FSleepBody& Body)
+{
+	UPrimitiveComponent* Component = Body.Component.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	Component->OnComponentHit.RemoveDynamic(this, &UFarmPhysicsSleepSubsystem::OnDemotedBodyHit);
+	Component->SetNotifyRigidBodyCollision(Body.bOriginalNotifyHit);
+	Component->SetCollisionEnabled(Body.OriginalCollision);
+	Component->SetSimulatePhysics(true);
+	Component->WakeAllRigidBodies();
+
+	Body.State = EBodyState::Simulating;
+	Body.RestTime = 0.0f;
+}
+
+void UFarmPhysicsSleepSubsystem::UpdateBodies(float ElapsedTime)
+{
+	NumSimulated = 0;
+	NumAwake = 0;
+	NumDemoted = 0;
+
+	const float RestLinearSpeedSq = FMath::Square(RestLinearSpeed);
+	const float RestAngularSpeedSq = FMath::Square(RestAngularSpeed);
+
+	for (int32 Index = Bodies.Num() - 1; Index >= 0; --Index)
+	{
+		FSleepBody& Body = Bodies[Index];
+		UPrimitiveComponent* Component = Body.Component.Get();
+		if (!Component)
+		{
+			Bodies.RemoveAtSwap(Index);
+			continue;
+		}
+
+		switch (Body.State)
+		{
+		case EBodyState::Simulating:
+		{
+			if (!Component->IsSimulatingPhysics())
+			{
+				// Someone else turned simulation off (e.g. a drop without physics)
+				break;
+			}
+
+			++NumSimulated;
+
+			const bool bAwake = Component->RigidBodyIsAwake();
+			const bool bAtRest = !bAwake
+				|| (Component->GetPhysicsLinearVelocity().SizeSquared() <= RestLinearSpeedSq
+					&& Component->GetPhysicsAngularVelocityInDegrees().SizeSquared() <= RestAngularSpeedSq);
+
+			if (bAwake)
+			{
+				++NumAwake;
+			}
+
+			Body.RestTime = bAtRest ? Body.RestTime + ElapsedTime : 0.0f;
+
+			if (Body.RestTime >= SettleTime && !IsNearWakeSource(Component))
+			{
+				DemoteBody(Body);
+				--NumSimulated;
+				if (bAwake)
+				{
+					--NumAwake;
+				}
+				++NumDemoted;
+			}
+			break;
+		}
+
+		case EBodyState::Demoted:
+			if (IsNearWakeSource(Component))
+			{
+				PromoteBody(Body);
+				++NumSimulated;
+				++NumAwake;
+			}
+			else
+			{
+				++NumDemoted;
+			}
+			break;
+
+		case EBodyState::Held:
+			break;
+		}
+	}
+}
+
+void UFarmPhysicsSleepSubsystem::EnforceSimulatedCap()
+{
+	if (MaxSimulatedBodies <= 0 || NumSimulated <= MaxSimulatedBodies)
+	{
+		return;
+	}
+
+	// Only bodies that were at rest on the last check: a thrown or falling body is never frozen
+	// mid-air, the cap is exceeded until it lands
+	TArray<FSleepBody*> Candidates;
+	for (FSleepBody& Body : Bodies)
+	{
+		UPrimitiveComponent* Component = Body.Component.Get();
+		if (Component && Body.State == EBodyState::Simulating && Body.RestTime > 0.0f
+			&& Component->IsSimulatingPhysics() && !IsNearWakeSource(Component))
+		{
+			Candidates.Add(&Body);
+		}
+	}
+
+	// Most settled first
+	Candidates.Sort([](const FSleepBody& A, const FSleepBody& B) { return A.RestTime > B.RestTime; });
+
+	for (FSleepBody* Body : Candidates)
+	{
+		if (NumSimulated <= MaxSimulatedBodies)
+		{
+			break;
+		}
+
+		if (Body->Component->RigidBodyIsAwake())
+		{
+			--NumAwake;
+		}
+
+		DemoteBody(*Body);
+		--NumSimulated;
+		++NumDemoted;
+	}
+}
+
+bool UFarmPhysicsSleepSubsystem::IsNearWakeSource(const UPrimitiveComponent* Component) const
+{
+	const FBoxSphereBounds& Bounds = Component->Bounds;
+
+	for (const TWeakObjectPtr<USceneComponent>& Source : WakeSources)
+	{
+		if (const USceneComponent* SourceComponent = Source.Get())
+		{
+			const float Radius = WakeRadius + Bounds.SphereRadius;
+			if (FVector::DistSquared(SourceComponent->GetComponentLocation(), Bounds.Origin) <= Radius * Radius)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void UFarmPhysicsSleepSubsystem::OnDemotedBodyHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	// Ignore static geometry; only moving bodies should wake a demoted grabbable
+	if (OtherComp && OtherComp->IsSimulatingPhysics())
+	{
+		WakeBody(HitComponent);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+// ==================================================================
+// FarmPhysicsSleepSubsystem.h
+// Demotes settled grabbables out of the simulation and wakes them on demand
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FarmPhysicsSleepSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Keeps dropped seeds, cans and tools from simulating forever.
+ *
+ * Registered bodies that stay below the rest thresholds for SettleTime are
+ * demoted to kinematic (or query-only) proxies. They are promoted back when a
+ * wake source (the grip controllers) comes within WakeRadius, when something
+ * hits them, or when gameplay calls WakeBody/WakeBodiesInRadius.
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmPhysicsSleepSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Seconds between rest / proximity checks
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	float CheckInterval = 0.25f;
+
+	// Seconds below the thresholds before a body is demoted
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	float SettleTime = 1.5f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	float RestLinearSpeed = 5.0f;
+
+	// Degrees per second
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	float RestAngularSpeed = 10.0f;
+
+	// Distance from a wake source to a body's bounds that promotes it
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	float WakeRadius = 40.0f;
+
+	// Query-only proxies stop blocking other bodies; kinematic keeps them solid
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	bool bDemoteToQueryOnly = false;
+
+	// Cap on simulated grabbables (0 = no cap). The most settled ones are demoted first; bodies
+	// still moving are never demoted early, so the cap can be exceeded while they are
+	UPROPERTY(Config, EditAnywhere, Category = "Physics Sleep")
+	int32 MaxSimulatedBodies = 0;
+
+	static UFarmPhysicsSleepSubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterBody(UPrimitiveComponent* Component);
+	void UnregisterBody(UPrimitiveComponent* Component);
+
+	// Held bodies are promoted and never demoted until released
+	void SetBodyHeld(UPrimitiveComponent* Component, bool bHeld);
+
+	void RegisterWakeSource(USceneComponent* Source);
+	void UnregisterWakeSource(USceneComponent* Source);
+	const TArray<TWeakObjectPtr<USceneComponent>>& GetWakeSources() const { return WakeSources; }
+
+	void WakeBody(UPrimitiveComponent* Component);
+	void WakeBodiesInRadius(const FVector& Location, float Radius);
+
+	int32 GetSimulatedBodyCount() const { return NumSimulated; }
+	int32 GetAwakeBodyCount() const { return NumAwake; }
+	int32 GetDemotedBodyCount() const { return NumDemoted; }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	enum class EBodyState : uint8
+	{
+		Simulating,
+		Demoted,
+		Held
+	};
+
+	struct FSleepBody
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		EBodyState State = EBodyState::Simulating;
+		float RestTime = 0.0f;
+		ECollisionEnabled::Type OriginalCollision = ECollisionEnabled::QueryAndPhysics;
+		bool bOriginalNotifyHit = false;
+	};
+
+	FSleepBody* FindBody(const UPrimitiveComponent* Component);
+
+	void DemoteBody(FSleepBody& Body);
+	void PromoteBody(FSleepBody& Body);
+	void UpdateBodies(float ElapsedTime);
+	void EnforceSimulatedCap();
+	bool IsNearWakeSource(const UPrimitiveComponent* Component) const;
+
+	UFUNCTION()
+	void OnDemotedBodyHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+
+	TArray<FSleepBody> Bodies;
+	TArray<TWeakObjectPtr<USceneComponent>> WakeSources;
+
+	float TimeSinceLastCheck = 0.0f;
+	int32 NumSimulated = 0;
+	int32 NumAwake = 0;
+	int32 NumDemoted = 0;
+};
\ No newline at end of file
@@ -0,0 +1,381 @@
+// ==================================================================
+// FarmSoilMoistureSubsystem.cpp
+// ==================================================================
+
+#include "FarmSoilMoistureSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Soil Moisture Step"), STAT_FarmSoilMoistureStep, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Soil Moisture Cells"), STAT_FarmSoilMoistureCells, STATGROUP_HarvestHaven);
+
+namespace FarmSoilMoisture
+{
+	// Above 0.25 per neighbour the explicit step overshoots and oscillates
+	static constexpr float MaxStepDiffusion = 0.2f;
+
+	/**
+	 * 5-point stencil for padded rows [RowBegin, RowEnd):
+	 * Dst = clamp((C * (1 - 4K) + (L + R + U + D) * K) * Decay, 0, 1)
+	 * Four cells per iteration with unaligned loads; the row remainder goes scalar.
+	 */
+	static void StepRows(const float* Src, float* Dst, int32 Stride, int32 Width, int32 RowBegin, int32 RowEnd, float K, float Decay)
+	{
+		const VectorRegister4Float VecK = VectorSetFloat1(K);
+		const VectorRegister4Float VecCenter = VectorSetFloat1(1.0f - 4.0f * K);
+		const VectorRegister4Float VecDecay = VectorSetFloat1(Decay);
+		const VectorRegister4Float VecZero = VectorZeroFloat();
+		const VectorRegister4Float VecOne = VectorOneFloat();
+
+		for (int32 Row = RowBegin; Row < RowEnd; ++Row)
+		{
+			const float* Center = Src + Row * Stride;
+			const float* Up = Center - Stride;
+			const float* Down = Center + Stride;
+			float* Out = Dst + Row * Stride;
+
+			int32 X = 1;
+			for (; X + 3 <= Width; X += 4)
+			{
+				const VectorRegister4Float Neighbours = VectorAdd(
+					VectorAdd(VectorLoad(Center + X - 1), VectorLoad(Center + X + 1)),
+					VectorAdd(VectorLoad(Up + X), VectorLoad(Down + X)));
+
+				VectorRegister4Float Value = VectorMultiplyAdd(Neighbours, VecK, VectorMultiply(VectorLoad(Center + X), VecCenter));
+				Value = VectorMin(VectorMax(VectorMultiply(Value, VecDecay), VecZero), VecOne);
+				VectorStore(Value, Out + X);
+			}
+
+			for (; X <= Width; ++X)
+			{
+				const float Neighbours = Center[X - 1] + Center[X + 1] + Up[X] + Down[X];
+				Out[X] = FMath::Clamp((Center[X] * (1.0f - 4.0f * K) + Neighbours * K) * Decay, 0.0f, 1.0f);
+			}
+		}
+	}
+}
+
+UFarmSoilMoistureSubsystem* UFarmSoilMoistureSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmSoilMoistureSubsystem>() : nullptr;
+}
+
+void UFarmSoilMoistureSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FitToParcelas();
+}
+
+void UFarmSoilMoistureSubsystem::Deinitialize()
+{
+	PendingBounds.Init();
+	Current.Empty();
+	Next.Empty();
+	Width = 0;
+	Height = 0;
+	SET_DWORD_STAT(STAT_FarmSoilMoistureCells, 0);
+
+	Super::Deinitialize();
+}
+
+bool UFarmSoilMoistureSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================================
+// GRID
+// ============================================================
+
+void UFarmSoilMoistureSubsystem::FitToParcelas()
+{
+	PendingBounds.Init();
+
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	if (GridMax.X > GridMin.X && GridMax.Y > GridMin.Y)
+	{
+		InitializeGrid(FBox2D(GridMin, GridMax));
+		return;
+	}
+
+	TArray<AActor*> Parcelas;
+	UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("Parcela"), Parcelas);
+
+	FBox2D Bounds(ForceInit);
+	for (const AActor* Parcela : Parcelas)
+	{
+		FVector Center;
+		FVector Extent;
+		Parcela->GetActorBounds(false, Center, Extent);
+		Bounds += FVector2D(Center - Extent);
+		Bounds += FVector2D(Center + Extent);
+	}
+
+	if (!Bounds.bIsValid)
+	{
+		UE_LOG(LogHarvestHaven, Verbose, TEXT("SoilMoisture: No parcelas, grid not built"));
+		return;
+	}
+
+	InitializeGrid(Bounds.ExpandBy(FitMargin));
+}
+
+void UFarmSoilMoistureSubsystem::NotifyParcelaAdded(const AActor* Parcela)
+{
+	// A fixed area is not refitted
+	if (!bEnabled || !Parcela || (GridMax.X > GridMin.X && GridMax.Y > GridMin.Y))
+	{
+		return;
+	}
+
+	FVector Center;
+	FVector Extent;
+	Parcela->GetActorBounds(false, Center, Extent);
+	if (!Covers(Center - Extent) || !Covers(Center + Extent))
+	{
+		PendingBounds += FVector2D(Center - Extent);
+		PendingBounds += FVector2D(Center + Extent);
+	}
+}
+
+void UFarmSoilMoistureSubsystem::GrowToCover(const FBox2D& Bounds)
+{
+	const FBox2D Needed = Bounds.ExpandBy(FitMargin);
+	if (!IsActive())
+	{
+		InitializeGrid(Needed);
+		return;
+	}
+
+	// Each side that has to move goes past the parcels by a share of the grid, so parcels
+	// appearing along one edge grow it a logarithmic number of times instead of once per batch
+	const FBox2D Grid(Origin, Origin + FVector2D(Width, Height) * ActiveCellSize);
+	const FVector2D Slack = FVector2D::Max(Grid.GetSize() * FMath::Max(GrowSlack, 0.0f), FVector2D(FitMargin));
+
+	FBox2D Grown = Grid;
+	if (Needed.Min.X < Grid.Min.X)
+	{
+		Grown.Min.X = Needed.Min.X - Slack.X;
+	}
+	if (Needed.Min.Y < Grid.Min.Y)
+	{
+		Grown.Min.Y = Needed.Min.Y - Slack.Y;
+	}
+	if (Needed.Max.X > Grid.Max.X)
+	{
+		Grown.Max.X = Needed.Max.X + Slack.X;
+	}
+	if (Needed.Max.Y > Grid.Max.Y)
+	{
+		Grown.Max.Y = Needed.Max.Y + Slack.Y;
+	}
+
+	InitializeGrid(Grown);
+}
+
+void UFarmSoilMoistureSubsystem::InitializeGrid(const FBox2D& Bounds)
+{
+	FARM_LLM_SCOPE(Parcels);
+
+	// The old grid, to carry its moisture over
+	TArray<float> Previous = MoveTemp(Current);
+	const FVector2D PreviousOrigin = Origin;
+	const float PreviousCellSize = ActiveCellSize;
+	const int32 PreviousWidth = Width;
+	const int32 PreviousHeight = Height;
+	const int32 PreviousStride = Stride;
+
+	const FVector2D Size = Bounds.GetSize();
+
+	// Coarser cells when the area would need more than MaxCells
+	ActiveCellSize = FMath::Max(CellSize, 1.0f);
+	if (MaxCells > 0)
+	{
+		ActiveCellSize = FMath::Max(ActiveCellSize, FMath::Sqrt(Size.X * Size.Y / MaxCells));
+	}
+
+	Origin = Bounds.Min;
+	Width = FMath::Max(FMath::CeilToInt(Size.X / ActiveCellSize), 1);
+	Height = FMath::Max(FMath::CeilToInt(Size.Y / ActiveCellSize), 1);
+	Stride = Width + 2;
+
+	const int32 NumPadded = Stride * (Height + 2);
+	Current.Init(FMath::Clamp(InitialMoisture, 0.0f, 1.0f), NumPadded);
+	Next.Init(0.0f, NumPadded);
+	StepAccumulator = 0.0f;
+
+	// Each new cell takes the old cell under its centre
+	if (PreviousWidth > 0 && PreviousHeight > 0)
+	{
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			const float CenterY = Origin.Y + (Y + 0.5f) * ActiveCellSize;
+			const int32 OldY = FMath::FloorToInt((CenterY - PreviousOrigin.Y) / PreviousCellSize);
+			if (OldY < 0 || OldY >= PreviousHeight)
+			{
+				continue;
+			}
+
+			for (int32 X = 0; X < Width; ++X)
+			{
+				const float CenterX = Origin.X + (X + 0.5f) * ActiveCellSize;
+				const int32 OldX = FMath::FloorToInt((CenterX - PreviousOrigin.X) / PreviousCellSize);
+				if (OldX >= 0 && OldX < PreviousWidth)
+				{
+					Current[GetPaddedIndex(X, Y)] = Previous[(OldY + 1) * PreviousStride + (OldX + 1)];
+				}
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_FarmSoilMoistureCells, Width * Height);
+	UE_LOG(LogHarvestHaven, Log, TEXT("SoilMoisture: %dx%d cells of %.0f cm"), Width, Height, ActiveCellSize);
+}
+
+bool UFarmSoilMoistureSubsystem::GetCell(const FVector& Location, int32& OutX, int32& OutY) const
+{
+	if (!IsActive())
+	{
+		return false;
+	}
+
+	OutX = FMath::FloorToInt((Location.X - Origin.X) / ActiveCellSize);
+	OutY = FMath::FloorToInt((Location.Y - Origin.Y) / ActiveCellSize);
+	return OutX >= 0 && OutX < Width && OutY >= 0 && OutY < Height;
+}
+
+bool UFarmSoilMoistureSubsystem::Covers(const FVector& Location) const
+{
+	int32 X, Y;
+	return GetCell(Location, X, Y);
+}
+
+float UFarmSoilMoistureSubsystem::GetMoisture(const FVector& Location) const
+{
+	int32 X, Y;
+	return GetCell(Location, X, Y) ? Current[GetPaddedIndex(X, Y)] : 0.0f;
+}
+
+void UFarmSoilMoistureSubsystem::AddWater(const FVector& Location, float Radius, float Amount)
+{
+	if (!IsActive() || Amount <= 0.0f)
+	{
+		return;
+	}
+
+	if (Radius <= 0.0f)
+	{
+		int32 X, Y;
+		if (GetCell(Location, X, Y))
+		{
+			float& Moisture = Current[GetPaddedIndex(X, Y)];
+			Moisture = FMath::Min(Moisture + Amount, 1.0f);
+		}
+		return;
+	}
+
+	const int32 MinX = FMath::Max(FMath::FloorToInt((Location.X - Radius - Origin.X) / ActiveCellSize), 0);
+	const int32 MaxX = FMath::Min(FMath::FloorToInt((Location.X + Radius - Origin.X) / ActiveCellSize), Width - 1);
+	const int32 MinY = FMath::Max(FMath::FloorToInt((Location.Y - Radius - Origin.Y) / ActiveCellSize), 0);
+	const int32 MaxY = FMath::Min(FMath::FloorToInt((Location.Y + Radius - Origin.Y) / ActiveCellSize), Height - 1);
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const FVector2D CellCenter = Origin + FVector2D(X + 0.5f, Y + 0.5f) * ActiveCellSize;
+			const float Falloff = 1.0f - FVector2D::Distance(CellCenter, FVector2D(Location)) / Radius;
+			if (Falloff > 0.0f)
+			{
+				float& Moisture = Current[GetPaddedIndex(X, Y)];
+				Moisture = FMath::Min(Moisture + Amount * Falloff, 1.0f);
+			}
+		}
+	}
+}
+
+// ============================================================
+// SIMULATION
+// ============================================================
+
+void UFarmSoilMoistureSubsystem::Tick(float DeltaTime)
+{
+	if (PendingBounds.bIsValid)
+	{
+		const FBox2D Bounds = PendingBounds;
+		PendingBounds.Init();
+		GrowToCover(Bounds);
+	}
+
+	if (!IsActive() || UpdateRate <= 0.0f)
+	{
+		return;
+	}
+
+	const float StepSeconds = 1.0f / UpdateRate;
+	StepAccumulator += DeltaTime;
+
+	// Fixed step; after a hitch catch up by at most two steps and drop the rest
+	for (int32 NumSteps = 0; StepAccumulator >= StepSeconds && NumSteps < 2; ++NumSteps)
+	{
+		Step(StepSeconds);
+		StepAccumulator -= StepSeconds;
+	}
+
+	StepAccumulator = FMath::Min(StepAccumulator, StepSeconds);
+}
+
+void UFarmSoilMoistureSubsystem::Step(float StepSeconds)
+{
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSoilMoistureStep);
+
+	const float K = FMath::Clamp(DiffusionRate * StepSeconds, 0.0f, FarmSoilMoisture::MaxStepDiffusion);
+	const float Decay = FMath::Exp(-FMath::Max(EvaporationRate, 0.0f) * StepSeconds);
+
+	UpdateBorder(Current.GetData());
+
+	const float* Src = Current.GetData();
+	float* Dst = Next.GetData();
+	const int32 RowsPerStripe = FMath::Max(StripeRows, 1);
+	const int32 NumStripes = FMath::DivideAndRoundUp(Height, RowsPerStripe);
+
+	// Stripes only read Src and write their own rows of Dst
+	ParallelFor(NumStripes, [this, Src, Dst, RowsPerStripe, K, Decay](int32 Stripe)
+	{
+		const int32 RowBegin = 1 + Stripe * RowsPerStripe;
+		const int32 RowEnd = FMath::Min(RowBegin + RowsPerStripe, Height + 1);
+		FarmSoilMoisture::StepRows(Src, Dst, Stride, Width, RowBegin, RowEnd, K, Decay);
+	});
+
+	Swap(Current, Next);
+}
+
+void UFarmSoilMoistureSubsystem::UpdateBorder(float* Grid) const
+{
+	// Left/right columns
+	for (int32 Row = 1; Row <= Height; ++Row)
+	{
+		float* RowData = Grid + Row * Stride;
+		RowData[0] = RowData[1];
+		RowData[Width + 1] = RowData[Width];
+	}
+
+	// Top/bottom rows, corners included
+	FMemory::Memcpy(Grid, Grid + Stride, Stride * sizeof(float));
+	FMemory::Memcpy(Grid + (Height + 1) * Stride, Grid + Height * Stride, Stride * sizeof(float));
+}
+
+TStatId UFarmSoilMoistureSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFarmSoilMoistureSubsystem, STATGROUP_Tickables);
+}
\ No newline at end of file
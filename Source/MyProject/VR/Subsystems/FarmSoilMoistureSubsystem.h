@@ -0,0 +1,150 @@
+// ==================================================================
+// FarmSoilMoistureSubsystem.h
+// 2D soil moisture grid over the farm: watering, diffusion and evaporation
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FarmSoilMoistureSubsystem.generated.h"
+
+/**
+ * Soil moisture (0-1) on a regular XY grid covering the farm.
+ *
+ * Watering deposits into the cells under the spout; every step the moisture spreads to the four
+ * neighbours and evaporates. The step is a 5-point stencil run at a low fixed rate (UpdateRate),
+ * four cells at a time with SIMD, split into row stripes that run in parallel. Its cost depends
+ * on the grid size only, not on how many crops or watering cans there are.
+ *
+ * Crops over the grid read their cell's moisture; crops outside it (or with no grid) keep
+ * their own watering timer.
+ *
+ * The grid covers every actor tagged "Parcela" when the world begins play, unless GridMin /
+ * GridMax are set. Parcels that begin play later and fall outside it (NotifyParcelaAdded)
+ * grow the grid once on the next tick, from their own bounds (no actor search) plus GrowSlack
+ * of room on each side that moved, so a field spawning in batches reallocates a few times
+ * rather than once per batch; cells both grids cover keep their moisture.
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmSoilMoistureSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Off: no grid, crops use their watering timer
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	bool bEnabled = true;
+
+	// Cell edge (cm)
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float CellSize = 50.0f;
+
+	// Fixed grid area (world XY, cm). Left at zero, the grid fits the parcels
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	FVector2D GridMin = FVector2D::ZeroVector;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	FVector2D GridMax = FVector2D::ZeroVector;
+
+	// Border added around the parcels when fitting (cm)
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float FitMargin = 200.0f;
+
+	// Fraction of the grid size added past a late parcel on each side it grows the grid
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float GrowSlack = 0.25f;
+
+	// Above this many cells CellSize is raised until the grid fits
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	int32 MaxCells = 262144;
+
+	// Simulation steps per second
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float UpdateRate = 5.0f;
+
+	// Fraction of the difference with each neighbour exchanged per second
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float DiffusionRate = 0.05f;
+
+	// Fraction of the moisture lost per second
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float EvaporationRate = 0.02f;
+
+	// Moisture every cell starts with
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	float InitialMoisture = 1.0f;
+
+	// Rows per parallel stripe
+	UPROPERTY(Config, EditAnywhere, Category = "Soil Moisture")
+	int32 StripeRows = 32;
+
+	static UFarmSoilMoistureSubsystem* Get(const UObject* WorldContextObject);
+
+	// Rebuilds the grid over every actor tagged "Parcela" (or GridMin/GridMax when set)
+	UFUNCTION(BlueprintCallable, Category = "Soil Moisture")
+	void FitToParcelas();
+
+	// Rebuilds the grid over Bounds (world XY, cm); cells the previous grid covered keep their moisture
+	void InitializeGrid(const FBox2D& Bounds);
+
+	// Parcels call this from BeginPlay; one outside the grid grows it on the next tick
+	void NotifyParcelaAdded(const AActor* Parcela);
+
+	UFUNCTION(BlueprintPure, Category = "Soil Moisture")
+	bool IsActive() const { return Width > 0 && Height > 0; }
+
+	// True when Location falls on the grid
+	UFUNCTION(BlueprintPure, Category = "Soil Moisture")
+	bool Covers(const FVector& Location) const;
+
+	// Moisture (0-1) of the cell under Location; 0 off the grid
+	UFUNCTION(BlueprintPure, Category = "Soil Moisture")
+	float GetMoisture(const FVector& Location) const;
+
+	// Adds Amount at Location, falling off linearly to zero at Radius (0 = only that cell)
+	UFUNCTION(BlueprintCallable, Category = "Soil Moisture")
+	void AddWater(const FVector& Location, float Radius, float Amount);
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// One fixed step of diffusion + evaporation, Current -> Next, then swap
+	void Step(float StepSeconds);
+
+	// Copies the edge cells into the ghost border (no flow across the grid edge)
+	void UpdateBorder(float* Grid) const;
+
+	// Grows the grid (or builds it, when there is none) to cover Bounds plus FitMargin
+	void GrowToCover(const FBox2D& Bounds);
+
+	// Index into the padded grid for interior cell (X, Y)
+	int32 GetPaddedIndex(int32 X, int32 Y) const { return (Y + 1) * Stride + (X + 1); }
+	bool GetCell(const FVector& Location, int32& OutX, int32& OutY) const;
+
+	// Width x Height cells plus a one-cell ghost border on every side
+	TArray<float> Current;
+	TArray<float> Next;
+
+	FVector2D Origin = FVector2D::ZeroVector;
+	float ActiveCellSize = 0.0f;
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 Stride = 0;
+
+	float StepAccumulator = 0.0f;
+
+	// Parcels that began play off the grid since the last tick; batched so a bulk spawn grows once
+	FBox2D PendingBounds = FBox2D(ForceInit);
+};
\ No newline at end of file
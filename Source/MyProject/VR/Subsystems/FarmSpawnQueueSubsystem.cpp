@@ -0,0 +1,257 @@
+// ==================================================================
+// FarmSpawnQueueSubsystem.cpp
+// ==================================================================
+
+#include "FarmSpawnQueueSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmLog.h"
+#include "MyProject/VR/Diagnostics/FarmStats.h"
+#include "MyProject/VR/Subsystems/FarmActorPoolSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spawn Queue Process"), STAT_FarmSpawnQueueProcess, STATGROUP_HarvestHaven);
+DECLARE_CYCLE_STAT(TEXT("Spawn Queue Sort"), STAT_FarmSpawnQueueSort, STATGROUP_HarvestHaven);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawn Queue Pending"), STAT_FarmSpawnQueuePending, STATGROUP_HarvestHaven);
+
+UFarmSpawnQueueSubsystem* UFarmSpawnQueueSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFarmSpawnQueueSubsystem>() : nullptr;
+}
+
+int32 UFarmSpawnQueueSubsystem::SubmitBatch(TArray<FFarmSpawnRequest>&& Spawns, const TArray<AActor*>& Destroys, EFarmWorkPriority DestroyPriority)
+{
+	const int32 NumRequests = Spawns.Num() + Destroys.Num();
+	if (NumRequests == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 BatchId = NextBatchId++;
+	Batches.Add(BatchId).Total = NumRequests;
+	NumQueued += NumRequests;
+
+	Pending.Reserve(Pending.Num() + NumRequests);
+
+	for (FFarmSpawnRequest& Spawn : Spawns)
+	{
+		FPendingRequest& Request = Pending.AddDefaulted_GetRef();
+		Request.BatchId = BatchId;
+		Request.Sequence = NextSequence++;
+		Request.Priority = Spawn.Priority;
+		Request.Location = Spawn.Transform.GetLocation();
+		Request.Class = Spawn.Class;
+		Request.Transform = Spawn.Transform;
+		Request.Owner = Spawn.Owner;
+		Request.MemorySystem = Spawn.MemorySystem;
+		Request.Initialize = MoveTemp(Spawn.Initialize);
+		Request.OnSpawned = MoveTemp(Spawn.OnSpawned);
+	}
+
+	for (AActor* Actor : Destroys)
+	{
+		FPendingRequest& Request = Pending.AddDefaulted_GetRef();
+		Request.BatchId = BatchId;
+		Request.Sequence = NextSequence++;
+		Request.Priority = DestroyPriority;
+		Request.Location = Actor ? Actor->GetActorLocation() : FVector::ZeroVector;
+		Request.ActorToDestroy = Actor;
+	}
+
+	bSortDirty = true;
+	SET_DWORD_STAT(STAT_FarmSpawnQueuePending, Pending.Num());
+
+	// One frame-budget item per request; each runs whichever request is best when its turn comes
+	UFarmFrameBudgetSubsystem* FrameBudget = UFarmFrameBudgetSubsystem::Get(this);
+	for (int32 Index = 0; Index < NumRequests; ++Index)
+	{
+		if (FrameBudget)
+		{
+			FrameBudget->EnqueueWork(EFarmWorkSystem::SpawnQueue, this, [this]() { ProcessNext(); });
+		}
+		else
+		{
+			ProcessNext();
+		}
+	}
+
+	UE_LOG(LogHarvestHaven, Log, TEXT("SpawnQueue: Batch %d queued - %d spawns, %d destroys"), BatchId, Spawns.Num(), Destroys.Num());
+	return BatchId;
+}
+
+void UFarmSpawnQueueSubsystem::CancelBatch(int32 BatchId)
+{
+	const FBatch* Batch = Batches.Find(BatchId);
+	if (!Batch)
+	{
+		return;
+	}
+
+	// The frame-budget items left over find nothing to run and return
+	NumQueued -= Batch->Total - Batch->Done;
+	Pending.RemoveAll([BatchId](const FPendingRequest& Request) { return Request.BatchId == BatchId; });
+	Batches.Remove(BatchId);
+
+	if (Pending.Num() == 0)
+	{
+		NumQueued = 0;
+		NumDone = 0;
+	}
+
+	SET_DWORD_STAT(STAT_FarmSpawnQueuePending, Pending.Num());
+}
+
+float UFarmSpawnQueueSubsystem::GetBatchProgress(int32 BatchId) const
+{
+	const FBatch* Batch = Batches.Find(BatchId);
+	return Batch && Batch->Total > 0 ? static_cast<float>(Batch->Done) / Batch->Total : 1.0f;
+}
+
+float UFarmSpawnQueueSubsystem::GetProgress() const
+{
+	return NumQueued > 0 ? static_cast<float>(NumDone) / NumQueued : 1.0f;
+}
+
+void UFarmSpawnQueueSubsystem::Deinitialize()
+{
+	Pending.Reset();
+	Batches.Reset();
+	SET_DWORD_STAT(STAT_FarmSpawnQueuePending, 0);
+
+	Super::Deinitialize();
+}
+
+void UFarmSpawnQueueSubsystem::ProcessNext()
+{
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSpawnQueueProcess);
+
+	SortIfNeeded();
+
+	FPendingRequest Request = Pending.Pop(EAllowShrinking::No);
+
+	if (Request.Class)
+	{
+		SpawnRequest(Request);
+	}
+	else if (AActor* Actor = Request.ActorToDestroy.Get())
+	{
+		UFarmActorPoolSubsystem::Release(Actor);
+	}
+
+	SET_DWORD_STAT(STAT_FarmSpawnQueuePending, Pending.Num());
+	CompleteRequest(Request.BatchId);
+}
+
+void UFarmSpawnQueueSubsystem::SpawnRequest(FPendingRequest& Request)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Covers the actor's construction and BeginPlay, which run in FinishSpawning
+	FARM_LLM_SCOPE_DYNAMIC(Request.MemorySystem);
+	AActor* Actor = World->SpawnActorDeferred<AActor>(Request.Class, Request.Transform, Request.Owner.Get(), nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Actor)
+	{
+		UE_LOG(LogHarvestHaven, Warning, TEXT("SpawnQueue: Failed to spawn %s"), *GetNameSafe(Request.Class));
+		return;
+	}
+
+	if (Request.Initialize)
+	{
+		Request.Initialize(Actor);
+	}
+
+	Actor->FinishSpawning(Request.Transform);
+
+	if (Request.OnSpawned)
+	{
+		Request.OnSpawned(Actor);
+	}
+}
+
+void UFarmSpawnQueueSubsystem::SortIfNeeded()
+{
+	// Player movement is checked on the first request of each frame; new batches sort right away
+	if (!bSortDirty && LastSortCheckFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastSortCheckFrame = GFrameCounter;
+
+	FVector ViewLocation = FVector::ZeroVector;
+	const bool bHasView = GetViewLocation(ViewLocation);
+
+	const bool bViewMoved = bHasView && FVector::DistSquared(ViewLocation, LastSortLocation) > FMath::Square(ResortDistance);
+	if (!bSortDirty && !bViewMoved)
+	{
+		return;
+	}
+
+	FARM_SCOPE_CYCLE_COUNTER(STAT_FarmSpawnQueueSort);
+
+	for (FPendingRequest& Request : Pending)
+	{
+		Request.DistanceSq = bHasView ? FVector::DistSquared(Request.Location, ViewLocation) : 0.0;
+	}
+
+	// Next to run goes last: highest priority, then nearest, then oldest
+	Pending.Sort([](const FPendingRequest& A, const FPendingRequest& B)
+	{
+		if (A.Priority != B.Priority)
+		{
+			return A.Priority > B.Priority;
+		}
+		if (A.DistanceSq != B.DistanceSq)
+		{
+			return A.DistanceSq > B.DistanceSq;
+		}
+		return A.Sequence > B.Sequence;
+	});
+
+	LastSortLocation = ViewLocation;
+	bSortDirty = false;
+}
+
+void UFarmSpawnQueueSubsystem::CompleteRequest(int32 BatchId)
+{
+	++NumDone;
+
+	if (FBatch* Batch = Batches.Find(BatchId))
+	{
+		if (++Batch->Done >= Batch->Total)
+		{
+			Batches.Remove(BatchId);
+			UE_LOG(LogHarvestHaven, Log, TEXT("SpawnQueue: Batch %d done"), BatchId);
+			OnBatchCompleted.Broadcast(BatchId);
+		}
+	}
+
+	if (Pending.Num() == 0)
+	{
+		NumQueued = 0;
+		NumDone = 0;
+	}
+}
+
+bool UFarmSpawnQueueSubsystem::GetViewLocation(FVector& OutLocation) const
+{
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PlayerController)
+	{
+		return false;
+	}
+
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(OutLocation, ViewRotation);
+	return true;
+}
\ No newline at end of file
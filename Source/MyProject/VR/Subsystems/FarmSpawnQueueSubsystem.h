@@ -0,0 +1,129 @@
+// ==================================================================
+// FarmSpawnQueueSubsystem.h
+// Spreads bulk farm spawns and destroys across frames, nearest to the player first
+// ==================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "MyProject/VR/Subsystems/FarmFrameBudgetSubsystem.h"
+#include "FarmSpawnQueueSubsystem.generated.h"
+
+// One actor to spawn through UFarmSpawnQueueSubsystem
+struct FFarmSpawnRequest
+{
+	TSubclassOf<AActor> Class;
+	FTransform Transform;
+	AActor* Owner = nullptr;
+	EFarmWorkPriority Priority = EFarmWorkPriority::Normal;
+
+	// LLM tag for the spawn; Count leaves it untagged, since the queue runs outside the caller's scope
+	EFarmMemorySystem MemorySystem = EFarmMemorySystem::Count;
+
+	// Runs between SpawnActorDeferred and FinishSpawning, so BeginPlay already sees the setup
+	TFunction<void(AActor*)> Initialize;
+
+	// Runs after the actor has begun play
+	TFunction<void(AActor*)> OnSpawned;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFarmSpawnBatchCompleted, int32, BatchId);
+
+/**
+ * Queue for loading a farm or bulk-planting/clearing parcels without a frozen frame.
+ *
+ * A batch of spawn and destroy requests is sorted by priority and then by distance to the
+ * player, and worked off through UFarmFrameBudgetSubsystem's SpawnQueue system, so each frame
+ * only runs what fits in that system's budget. Spawns are deferred (SpawnActorDeferred /
+ * FinishSpawning); destroys go through the actor pool. When the player moves more than
+ * ResortDistance the remaining requests are re-sorted.
+ *
+ * Loading UI can poll GetProgress / GetBatchProgress or bind OnBatchCompleted.
+ */
+UCLASS(config=Game)
+class MYPROJECT_API UFarmSpawnQueueSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Player movement (cm) that re-sorts the pending requests by distance
+	UPROPERTY(Config, EditAnywhere, Category = "Spawn Queue")
+	float ResortDistance = 300.0f;
+
+	UPROPERTY(BlueprintAssignable, Category = "Spawn Queue")
+	FOnFarmSpawnBatchCompleted OnBatchCompleted;
+
+	static UFarmSpawnQueueSubsystem* Get(const UObject* WorldContextObject);
+
+	// Queues spawns and destroys as one batch. Returns the batch id, or INDEX_NONE if both are empty
+	int32 SubmitBatch(TArray<FFarmSpawnRequest>&& Spawns, const TArray<AActor*>& Destroys = TArray<AActor*>(),
+		EFarmWorkPriority DestroyPriority = EFarmWorkPriority::Normal);
+
+	// Drops the batch's requests that have not run yet
+	UFUNCTION(BlueprintCallable, Category = "Spawn Queue")
+	void CancelBatch(int32 BatchId);
+
+	// 0-1 for one batch; 1 once it has finished
+	UFUNCTION(BlueprintPure, Category = "Spawn Queue")
+	float GetBatchProgress(int32 BatchId) const;
+
+	// 0-1 over everything queued since the queue was last empty
+	UFUNCTION(BlueprintPure, Category = "Spawn Queue")
+	float GetProgress() const;
+
+	UFUNCTION(BlueprintPure, Category = "Spawn Queue")
+	bool IsBatchPending(int32 BatchId) const { return Batches.Contains(BatchId); }
+
+	UFUNCTION(BlueprintPure, Category = "Spawn Queue")
+	int32 GetPendingCount() const { return Pending.Num(); }
+
+	virtual void Deinitialize() override;
+
+private:
+	struct FPendingRequest
+	{
+		int32 BatchId = INDEX_NONE;
+		int32 Sequence = 0;
+		EFarmWorkPriority Priority = EFarmWorkPriority::Normal;
+		FVector Location = FVector::ZeroVector;
+		double DistanceSq = 0.0;
+
+		// Spawn when Class is set, destroy otherwise
+		TSubclassOf<AActor> Class;
+		FTransform Transform;
+		TWeakObjectPtr<AActor> Owner;
+		EFarmMemorySystem MemorySystem = EFarmMemorySystem::Count;
+		TFunction<void(AActor*)> Initialize;
+		TFunction<void(AActor*)> OnSpawned;
+
+		TWeakObjectPtr<AActor> ActorToDestroy;
+	};
+
+	struct FBatch
+	{
+		int32 Total = 0;
+		int32 Done = 0;
+	};
+
+	// One call per frame-budget item: runs the best request pending at that moment
+	void ProcessNext();
+	void SpawnRequest(FPendingRequest& Request);
+	void SortIfNeeded();
+	void CompleteRequest(int32 BatchId);
+	bool GetViewLocation(FVector& OutLocation) const;
+
+	// Sorted so the next request to run is last
+	TArray<FPendingRequest> Pending;
+	TMap<int32, FBatch> Batches;
+
+	int32 NextBatchId = 0;
+	int32 NextSequence = 0;
+	int32 NumQueued = 0;
+	int32 NumDone = 0;
+
+	bool bSortDirty = false;
+	uint64 LastSortCheckFrame = 0;
+	FVector LastSortLocation = FVector::ZeroVector;
+};
\ No newline at end of file
@@ -0,0 +1,72 @@
+// ==================================================================
+// FarmMemoryBudgetTests.cpp
+// Fails when the farm stress scenario pushes a system over its memory budget
+// ==================================================================
+
+#include "MyProject/VR/Commandlets/FarmStressCommandlet.h"
+#include "MyProject/VR/Diagnostics/FarmMemory.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Runs the stress commandlet's scenario (-FarmStressCount parcels, default 1000) and checks the
+ * farm LLM tags against UFarmMemoryBudgetSubsystem's budgets once per cycle. Needs -llm: without
+ * LLM nothing can be measured, and the test fails rather than passing unchecked.
+ *
+ *   UnrealEditor-Cmd MyProject.uproject -nullrhi -unattended -llm
+ *       -ExecCmds="Automation RunTests MyProject.Farm.Stress.MemoryBudgets; Quit" [-FarmStressCount=10000]
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmMemoryBudgetTest, "MyProject.Farm.Stress.MemoryBudgets",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::StressFilter)
+
+bool FFarmMemoryBudgetTest::RunTest(const FString& Parameters)
+{
+	if (!FFarmMemory::IsTrackingEnabled())
+	{
+		AddError(TEXT("Memory budgets not checked: LLM is not tracking, run with -llm"));
+		return false;
+	}
+
+	int32 ParcelCount = 1000;
+	FParse::Value(FCommandLine::Get(), TEXT("FarmStressCount="), ParcelCount);
+
+	UFarmStressCommandlet::FRunSettings Settings;
+	UFarmStressCommandlet::FRunResult Result;
+
+	TStrongObjectPtr<UFarmStressCommandlet> Stress(NewObject<UFarmStressCommandlet>());
+
+	// Farm actors log every state change; keep the test log readable
+	const ELogVerbosity::Type PreviousVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Warning);
+	const bool bSucceeded = Stress->RunCount(FMath::Max(1, ParcelCount), Settings, Result);
+	LogTemp.SetVerbosity(PreviousVerbosity);
+
+	if (!TestTrue(TEXT("Stress scenario ran"), bSucceeded))
+	{
+		return false;
+	}
+
+	if (!TestTrue(TEXT("Memory budgets were sampled"), Result.BudgetSamples > 0))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < static_cast<int32>(EFarmMemorySystem::Count); ++Index)
+	{
+		const TCHAR* SystemName = FFarmMemory::GetSystemName(static_cast<EFarmMemorySystem>(Index));
+		AddTelemetryData(FString::Printf(TEXT("%sPeakMB"), SystemName), Result.FarmMemoryPeakMB[Index]);
+		AddInfo(FString::Printf(TEXT("%s: peak %.2f MB of %.2f MB"), SystemName, Result.FarmMemoryPeakMB[Index], Result.FarmMemoryBudgetMB[Index]));
+	}
+
+	for (const FString& System : Result.OverBudgetSystems)
+	{
+		AddError(FString::Printf(TEXT("N=%d: %s"), Result.ParcelCount, *System));
+	}
+
+	return Result.OverBudgetSystems.Num() == 0;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,417 @@
+// ==================================================================
+// FarmPerfTests.cpp
+// Perf automation tests (ns/op, allocations/op) for farm hot paths
+// ==================================================================
+
+#include "MyProject/VR/Actors/Cultivo.h"
+#include "MyProject/VR/Actors/DiggableTerrainActor.h"
+#include "MyProject/VR/Actors/ParcelaTierra.h"
+#include "MyProject/VR/Actors/SeedItem.h"
+#include "MyProject/VR/Actors/WateringCan.h"
+#include "MyProject/VR/Commandlets/FarmHeadlessWorld.h"
+#include "MyProject/VR/Components/VRGrabComponent.h"
+#include "MyProject/VR/Components/VRInteractionComponent.h"
+#include "MyProject/VR/Components/VRPourStreamComponent.h"
+#include "MyProject/VR/Diagnostics/FarmAllocCounter.h"
+#include "MyProject/VR/GameModes/HarvestHavenGameManager.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "MotionControllerComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Each test runs one hot path in a tight loop against a fixed fixture in a headless game world
+ * and reports ns/op, allocations/op and bytes/op as telemetry (and to the log).
+ *
+ *   UnrealEditor-Cmd MyProject.uproject -nullrhi -unattended
+ *       -ExecCmds="Automation RunTests MyProject.Farm.Perf; Quit" [-FarmPerfIterations=100000] [-FarmPerfActors=500]
+ *
+ * Allocations are counted by wrapping GMalloc while a benchmark runs, so run them on an
+ * otherwise idle process.
+ */
+namespace FarmPerfTests
+{
+	constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter;
+
+	constexpr int32 WarmupDivisor = 10;
+	constexpr float FarAway = 1000000.0f;
+	constexpr float FrameTime = 1.0f / 72.0f;
+	constexpr float PourCheckStep = 0.31f;
+
+	// Keeps results alive so the optimizer cannot drop the benchmark body
+	volatile int64 Sink = 0;
+
+	int32 GetIterations()
+	{
+		int32 Iterations = 100000;
+		FParse::Value(FCommandLine::Get(), TEXT("FarmPerfIterations="), Iterations);
+		return FMath::Max(1, Iterations);
+	}
+
+	int32 GetFixtureActors()
+	{
+		int32 FixtureActors = 500;
+		FParse::Value(FCommandLine::Get(), TEXT("FarmPerfActors="), FixtureActors);
+		return FMath::Max(1, FixtureActors);
+	}
+
+	/**
+	 * Headless world for one test, running the game's own game manager as its game mode; the
+	 * targets log on every call, so LogTemp is quieted meanwhile.
+	 */
+	class FFixture
+	{
+	public:
+		FFixture()
+			: PreviousVerbosity(LogTemp.GetVerbosity())
+		{
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			bCreated = HeadlessWorld.Create(FString(), AHarvestHavenGameManager::StaticClass());
+			LogTemp.SetVerbosity(ELogVerbosity::Error);
+		}
+
+		~FFixture()
+		{
+			LogTemp.SetVerbosity(PreviousVerbosity);
+			HeadlessWorld.Destroy();
+		}
+
+		bool IsValid(FAutomationTestBase& Test) const
+		{
+			return Test.TestTrue(TEXT("Headless world created"), bCreated && HeadlessWorld.GetWorld() != nullptr);
+		}
+
+		UWorld* GetWorld() const { return HeadlessWorld.GetWorld(); }
+
+		template<typename T>
+		T* Spawn(const FVector& Location = FVector::ZeroVector)
+		{
+			return GetWorld()->SpawnActor<T>(T::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+		}
+
+		// Crops and prepared parcels on a grid near the origin; scanners sit at FarAway so a scan
+		// visits every candidate without finding one
+		void SpawnScanTargets(int32 Count)
+		{
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				const FVector Location((Index % GridSize) * 150.0f, (Index / GridSize) * 150.0f, 0.0f);
+				Spawn<ACultivo>(Location);
+
+				if (AParcelaTierra* Parcela = Spawn<AParcelaTierra>(Location))
+				{
+					Parcela->PrepareGround();
+				}
+			}
+		}
+
+	private:
+		FFarmHeadlessWorld HeadlessWorld;
+		FActorSpawnParameters SpawnParams;
+		ELogVerbosity::Type PreviousVerbosity;
+		bool bCreated = false;
+	};
+
+	void RunBench(FAutomationTestBase& Test, const FString& Name, TFunctionRef<void()> Body)
+	{
+		const int32 Iterations = GetIterations();
+
+		for (int32 Index = 0; Index < Iterations / WarmupDivisor; ++Index)
+		{
+			Body();
+		}
+
+		uint64 Allocations = 0;
+		uint64 Bytes = 0;
+		double Elapsed = 0.0;
+		{
+			FFarmAllocCounter AllocCounter;
+
+			const double Start = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				Body();
+			}
+			Elapsed = FPlatformTime::Seconds() - Start;
+
+			Allocations = AllocCounter.GetAllocations();
+			Bytes = AllocCounter.GetBytes();
+		}
+
+		const double NsPerOp = (Elapsed * 1.0e9) / Iterations;
+		const double AllocsPerOp = static_cast<double>(Allocations) / Iterations;
+		const double BytesPerOp = static_cast<double>(Bytes) / Iterations;
+
+		Test.AddTelemetryData(TEXT("NsPerOp"), NsPerOp, Name);
+		Test.AddTelemetryData(TEXT("AllocsPerOp"), AllocsPerOp, Name);
+		Test.AddTelemetryData(TEXT("BytesPerOp"), BytesPerOp, Name);
+		Test.AddInfo(FString::Printf(TEXT("%s: %d iterations, %.1f ns/op, %.2f allocs/op, %.1f bytes/op"),
+			*Name, Iterations, NsPerOp, AllocsPerOp, BytesPerOp));
+	}
+}
+
+// ===== Game manager =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfGameManagerTest, "MyProject.Farm.Perf.GameManager", FarmPerfTests::TestFlags)
+
+bool FFarmPerfGameManagerTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	AHarvestHavenGameManager* GameManager = AHarvestHavenGameManager::GetGameManager(Fixture.GetWorld());
+	if (!TestNotNull(TEXT("Game manager is the world's game mode"), GameManager))
+	{
+		return false;
+	}
+
+	FarmPerfTests::RunBench(*this, TEXT("GameManager.GetCropInfo"), [GameManager]()
+	{
+		FarmPerfTests::Sink += GameManager->GetCropInfo(ECultivoType::Tomate).SellPrice;
+	});
+
+	// Enough money for every purchase, so each call takes the success path
+	const int32 Iterations = FarmPerfTests::GetIterations();
+	GameManager->AddMoney(GameManager->GetSeedCost(ECultivoType::Zanahoria) * (Iterations + Iterations / FarmPerfTests::WarmupDivisor + 1));
+	FarmPerfTests::RunBench(*this, TEXT("GameManager.BuySeeds"), [GameManager]()
+	{
+		FarmPerfTests::Sink += GameManager->BuySeeds(ECultivoType::Zanahoria, 1);
+	});
+
+	FarmPerfTests::RunBench(*this, TEXT("GameManager.SellCrop"), [GameManager]()
+	{
+		FarmPerfTests::Sink += GameManager->SellCrop(ECultivoType::Zanahoria, 1);
+	});
+
+	return true;
+}
+
+// ===== Crop update =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfCultivoTickTest, "MyProject.Farm.Perf.Cultivo.Tick", FarmPerfTests::TestFlags)
+
+bool FFarmPerfCultivoTickTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	ACultivo* Cultivo = Fixture.Spawn<ACultivo>();
+	if (!TestNotNull(TEXT("Cultivo"), Cultivo))
+	{
+		return false;
+	}
+
+	// Never matures, so every call runs the growing branch plus the watering check
+	Cultivo->TiempoCrecimientoSegundos = TNumericLimits<float>::Max();
+	Cultivo->SetActorTickEnabled(false);
+
+	FarmPerfTests::RunBench(*this, TEXT("Cultivo.Tick"), [Cultivo]()
+	{
+		Cultivo->Tick(FarmPerfTests::FrameTime);
+	});
+
+	return true;
+}
+
+// ===== Dig history =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfDiggableTerrainTest, "MyProject.Farm.Perf.DiggableTerrain.OnDig", FarmPerfTests::TestFlags)
+
+bool FFarmPerfDiggableTerrainTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	ADiggableTerrainActor* Terrain = Fixture.Spawn<ADiggableTerrainActor>();
+	if (!TestNotNull(TEXT("Terrain"), Terrain))
+	{
+		return false;
+	}
+
+	// A full history (MaxHoles defaults to 50) in a row; digging again next to the newest hole
+	// scans all of them before it is rejected as already dug
+	constexpr int32 NumHoles = 50;
+	constexpr float HoleSpacing = 50.0f;
+	constexpr float HoleRadius = 15.0f;
+	for (int32 Index = 0; Index < NumHoles; ++Index)
+	{
+		Terrain->OnDig(FVector(Index * HoleSpacing, 0.0f, 0.0f), HoleRadius, 10.0f, FVector::UpVector);
+	}
+
+	const FVector DugLocation((NumHoles - 1) * HoleSpacing + 1.0f, 0.0f, 0.0f);
+	FarmPerfTests::RunBench(*this, TEXT("DiggableTerrain.OnDig(already dug)"), [Terrain, DugLocation]()
+	{
+		Terrain->OnDig(DugLocation, HoleRadius, 10.0f, FVector::UpVector);
+	});
+
+	return true;
+}
+
+// ===== Proximity scans =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfWateringCanTest, "MyProject.Farm.Perf.WateringCan.CheckForCropsToWater", FarmPerfTests::TestFlags)
+
+bool FFarmPerfWateringCanTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	const int32 FixtureActors = FarmPerfTests::GetFixtureActors();
+	Fixture.SpawnScanTargets(FixtureActors);
+
+	AWateringCan* WateringCan = Fixture.Spawn<AWateringCan>(FVector(FarmPerfTests::FarAway, FarmPerfTests::FarAway, 0.0f));
+	if (!TestNotNull(TEXT("Watering can"), WateringCan))
+	{
+		return false;
+	}
+
+	// Tick only collects the pour impacts every 0.3 s of world time, so each iteration moves the
+	// clock past that interval
+	UWorld* World = Fixture.GetWorld();
+	FarmPerfTests::RunBench(*this, FString::Printf(TEXT("WateringCan.Tick+CheckForCropsToWater(%d)"), FixtureActors), [WateringCan, World]()
+	{
+		World->TimeSeconds += FarmPerfTests::PourCheckStep;
+		WateringCan->Tick(FarmPerfTests::FrameTime);
+	});
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfSeedItemTest, "MyProject.Farm.Perf.SeedItem.CheckForPlantableGround", FarmPerfTests::TestFlags)
+
+bool FFarmPerfSeedItemTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	const int32 FixtureActors = FarmPerfTests::GetFixtureActors();
+	Fixture.SpawnScanTargets(FixtureActors);
+
+	ASeedItem* Seed = Fixture.Spawn<ASeedItem>(FVector(FarmPerfTests::FarAway, FarmPerfTests::FarAway, 0.0f));
+	UVRGrabComponent* SeedGrab = Seed ? Seed->FindComponentByClass<UVRGrabComponent>() : nullptr;
+	if (!TestNotNull(TEXT("Seed"), Seed) || !TestNotNull(TEXT("Seed grab component"), SeedGrab))
+	{
+		return false;
+	}
+
+	// Releasing the seed checks for ground right away, the same scan the periodic check runs
+	FarmPerfTests::RunBench(*this, FString::Printf(TEXT("SeedItem.OnReleased+CheckForPlantableGround(%d)"), FixtureActors), [SeedGrab]()
+	{
+		SeedGrab->OnToolReleased.Broadcast();
+	});
+
+	return true;
+}
+
+// ===== Pour stream =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfPourStreamTest, "MyProject.Farm.Perf.PourStream.Simulate", FarmPerfTests::TestFlags)
+
+bool FFarmPerfPourStreamTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	AActor* Owner = Fixture.Spawn<AActor>();
+	if (!TestNotNull(TEXT("Pour stream owner"), Owner))
+	{
+		return false;
+	}
+
+	UVRPourStreamComponent* PourStream = NewObject<UVRPourStreamComponent>(Owner);
+	PourStream->RegisterComponent();
+
+	// Full-flow pour over empty space: particles never land, so the stream sits at
+	// ParticlesPerSecond * MaxLifetime. The world does not tick here, so the first async
+	// heightfield batch never returns and only the game-thread part of the stream is timed
+	PourStream->SetEmitter(FVector(FarmPerfTests::FarAway, FarmPerfTests::FarAway, 100.0f), FVector::ForwardVector, 1.0f);
+	FarmPerfTests::RunBench(*this, TEXT("PourStream.Simulate"), [PourStream]()
+	{
+		PourStream->Simulate(FarmPerfTests::FrameTime);
+		FarmPerfTests::Sink += PourStream->GetNumParticles();
+	});
+	PourStream->StopEmitting();
+
+	return true;
+}
+
+// ===== Grab dispatch =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFarmPerfGrabTest, "MyProject.Farm.Perf.VRInteraction.GrabRelease", FarmPerfTests::TestFlags)
+
+bool FFarmPerfGrabTest::RunTest(const FString& Parameters)
+{
+	FarmPerfTests::FFixture Fixture;
+	if (!Fixture.IsValid(*this))
+	{
+		return false;
+	}
+
+	AActor* HandActor = Fixture.Spawn<AActor>();
+	AActor* PropActor = Fixture.Spawn<AActor>();
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Hand"), HandActor) || !TestNotNull(TEXT("Prop"), PropActor) || !TestNotNull(TEXT("Cube mesh"), Cube))
+	{
+		return false;
+	}
+
+	UMotionControllerComponent* Controller = NewObject<UMotionControllerComponent>(HandActor);
+	HandActor->SetRootComponent(Controller);
+	Controller->RegisterComponent();
+
+	// The grab query looks for physics bodies around the controller
+	UStaticMeshComponent* PropMesh = NewObject<UStaticMeshComponent>(PropActor);
+	PropMesh->SetStaticMesh(Cube);
+	PropMesh->SetCollisionObjectType(ECC_PhysicsBody);
+	PropMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	PropActor->SetRootComponent(PropMesh);
+	PropMesh->RegisterComponent();
+
+	UVRGrabComponent* GrabComponent = NewObject<UVRGrabComponent>(PropActor);
+	GrabComponent->RegisterComponent();
+
+	UVRInteractionComponent* Interaction = NewObject<UVRInteractionComponent>(HandActor);
+	Interaction->RegisterComponent();
+	Interaction->SetMotionControllers(Controller, nullptr);
+
+	// Timed as a pair (overlap query + dispatch through ProcessEvent) so the prop is free again
+	if (!TestTrue(TEXT("Fixture grab succeeds"), Interaction->TryGrabWithRightHand()))
+	{
+		return false;
+	}
+	Interaction->TryReleaseRightHand();
+
+	FarmPerfTests::RunBench(*this, TEXT("VRInteraction.TryGrab+TryReleaseRightHand"), [Interaction]()
+	{
+		FarmPerfTests::Sink += Interaction->TryGrabWithRightHand();
+		FarmPerfTests::Sink += Interaction->TryReleaseRightHand();
+	});
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,18 @@
+using UnrealBuildTool;
+
+public class MyProjectTests : ModuleRules
+{
+	public MyProjectTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"HeadMountedDisplay",
+			"MyProject"
+		});
+	}
+}
\ No newline at end of file